@@ -0,0 +1,422 @@
+#include "apu.h"
+#include "cat.h"
+#include <math.h>
+#include <string.h>
+
+const int APU_CLOCK = 4194304;
+const int FRAME_SEQ_CYCLES = APU_CLOCK / 512;
+const int MIX_SCALE = 64;  // 4 channels * 15 * volume 8 * 64 just fits
+
+// Duty step patterns, 12.5% 25% 50% 75%
+const uint8_t DUTY_WAVES[4] = {0x01, 0x81, 0x87, 0x7E};
+
+// NR32 output level to wave sample shift, first one mutes
+const int WAVE_SHIFTS[4] = {4, 0, 1, 2};
+
+struct ApuChannel {
+  bool isOn;  // Triggered and not silenced since
+  bool isDacOn;
+  bool isLengthOn;
+  int length;  // 256Hz clocks left
+  int freq;    // 11-bit
+  int timer;   // Cycles until the next waveform step
+  int pos;     // Duty or wave step
+
+  // Envelope, pulse and noise
+  int volume;
+  int envInitial;
+  int envDir;
+  int envPeriod;
+  int envTimer;
+
+  // Pulse
+  int duty;
+
+  // Sweep, pulse 1 only
+  bool isSweepOn;
+  bool isSweepDown;
+  int sweepPeriod;
+  int sweepShift;
+  int sweepTimer;
+  int shadowFreq;
+
+  // Wave
+  int waveShift;
+
+  // Noise
+  bool isNarrow;
+  int noisePeriod;
+  uint16_t lfsr;
+};
+
+struct Apu {
+  int sampleRate;
+  uint32_t cyclesPerSample;  // 16.16 fixed point
+  uint32_t cycleFrac;
+  int frameSeqTimer;
+  int frameSeqStep;
+
+  bool isPowered;
+  int volLeft, volRight;
+  uint8_t panning;
+  uint8_t regs[NR52 - NR10 + 1];  // As last written
+  uint8_t waveRam[16];
+  ApuChannel ch[4];
+
+  // Output capacitor, blocks the DC the DACs leave behind
+  float charge;
+  float capLeft, capRight;
+};
+
+/////// CHANNELS
+
+static int ChannelPeriod(const ApuChannel& c, int idx) {
+  switch (idx) {
+    case 0:
+    case 1:
+      return (2048 - c.freq) * 4;
+    case 2:
+      return (2048 - c.freq) * 2;
+    default:
+      return c.noisePeriod;
+  }
+}
+
+static void StepWaveform(ApuChannel& c, int idx) {
+  if (idx < 2) {
+    c.pos = (c.pos + 1) & 7;
+  } else if (idx == 2) {
+    c.pos = (c.pos + 1) & 31;
+  } else {
+    int x = (c.lfsr ^ (c.lfsr >> 1)) & 1;
+    c.lfsr = (uint16_t)((c.lfsr >> 1) | (x << 14));
+    if (c.isNarrow) c.lfsr = (uint16_t)((c.lfsr & ~0x40) | (x << 6));
+  }
+}
+
+// 0-15 as the DAC sees it
+static int ChannelOutput(const Apu& apu, int idx) {
+  const ApuChannel& c = apu.ch[idx];
+  switch (idx) {
+    case 0:
+    case 1:
+      return ((DUTY_WAVES[c.duty] >> (7 - c.pos)) & 1) ? c.volume : 0;
+    case 2: {
+      int s = apu.waveRam[c.pos >> 1];
+      s = (c.pos & 1) ? (s & 0xF) : (s >> 4);
+      return s >> c.waveShift;
+    }
+    default:
+      return (c.lfsr & 1) ? 0 : c.volume;
+  }
+}
+
+// Next sweep frequency, overflowing silences the channel
+static int SweepNext(ApuChannel& c) {
+  int delta = c.shadowFreq >> c.sweepShift;
+  int freq = c.isSweepDown ? (c.shadowFreq - delta) : (c.shadowFreq + delta);
+  if (freq > 2047) c.isOn = false;
+  return freq;
+}
+
+static void ClockSweep(ApuChannel& c) {
+  if (--c.sweepTimer > 0) return;
+  c.sweepTimer = c.sweepPeriod ? c.sweepPeriod : 8;
+  if (!c.isSweepOn || (c.sweepPeriod == 0)) return;
+
+  int freq = SweepNext(c);
+  if ((freq <= 2047) && (c.sweepShift > 0)) {
+    c.shadowFreq = freq;
+    c.freq = freq;
+    SweepNext(c);
+  }
+}
+
+static void ClockLength(ApuChannel& c) {
+  if (c.isLengthOn && (c.length > 0) && (--c.length == 0)) c.isOn = false;
+}
+
+static void ClockEnvelope(ApuChannel& c) {
+  if (c.envPeriod == 0) return;
+  if (--c.envTimer > 0) return;
+  c.envTimer = c.envPeriod;
+
+  int volume = c.volume + c.envDir;
+  if ((volume >= 0) && (volume <= 15)) c.volume = volume;
+}
+
+// 512Hz: length at 256Hz, sweep at 128Hz, envelopes at 64Hz
+static void ClockFrameSequencer(Apu& apu) {
+  int step = apu.frameSeqStep;
+  apu.frameSeqStep = (step + 1) & 7;
+
+  if ((step & 1) == 0) {
+    for (int i = 0; i < 4; ++i) ClockLength(apu.ch[i]);
+  }
+  if ((step == 2) || (step == 6)) ClockSweep(apu.ch[0]);
+  if (step == 7) {
+    ClockEnvelope(apu.ch[0]);
+    ClockEnvelope(apu.ch[1]);
+    ClockEnvelope(apu.ch[3]);
+  }
+}
+
+static void Trigger(ApuChannel& c, int idx) {
+  c.isOn = c.isDacOn;
+  if (c.length == 0) c.length = (idx == 2) ? 256 : 64;
+  c.timer = ChannelPeriod(c, idx);
+  c.pos = 0;
+  c.volume = c.envInitial;
+  c.envTimer = c.envPeriod;
+
+  if (idx == 3) c.lfsr = 0x7FFF;
+
+  if (idx == 0) {
+    c.shadowFreq = c.freq;
+    c.sweepTimer = c.sweepPeriod ? c.sweepPeriod : 8;
+    c.isSweepOn = (c.sweepPeriod > 0) || (c.sweepShift > 0);
+    if (c.sweepShift > 0) SweepNext(c);
+  }
+}
+
+static void SetEnvelope(ApuChannel& c, uint8_t value) {
+  c.envInitial = value >> 4;
+  c.envDir = (value & 0x08) ? 1 : -1;
+  c.envPeriod = value & 0x07;
+  c.isDacOn = (value & 0xF8) != 0;
+  if (!c.isDacOn) c.isOn = false;
+}
+
+static void PowerOff(Apu& apu) {
+  apu.isPowered = false;
+  memset(apu.regs, 0, sizeof(apu.regs));
+  memset(apu.ch, 0, sizeof(apu.ch));
+  apu.volLeft = 0;
+  apu.volRight = 0;
+  apu.panning = 0;
+  for (int i = 0; i < 4; ++i) apu.ch[i].noisePeriod = 8;
+}
+
+/////// API
+
+Apu* ApuCreate(int sampleRate) {
+  Apu* pApu = new Apu();
+  Apu& apu = *pApu;
+  apu.sampleRate = sampleRate;
+  apu.cyclesPerSample =
+      (uint32_t)(((uint64_t)APU_CLOCK << 16) / (uint64_t)sampleRate);
+  apu.cycleFrac = 0;
+  apu.frameSeqTimer = FRAME_SEQ_CYCLES;
+  apu.frameSeqStep = 0;
+  apu.charge = (float)pow(0.999958, (double)APU_CLOCK / sampleRate);
+  apu.capLeft = 0;
+  apu.capRight = 0;
+  PowerOff(apu);
+
+  // Boot state, full volume both sides, a soft saw in wave RAM
+  ApuWrite(pApu, NR52, 0x80);
+  ApuWrite(pApu, NR50, 0x77);
+  ApuWrite(pApu, NR51, 0xFF);
+  for (int i = 0; i < 16; ++i) {
+    ApuWrite(pApu, WAVE_RAM + i, (uint8_t)(i * 0x11));
+  }
+  return pApu;
+}
+
+void ApuDestroy(Apu* pApu) { delete pApu; }
+
+void ApuWrite(Apu* pApu, int reg, uint8_t value) {
+  Apu& apu = *pApu;
+  if ((reg >= WAVE_RAM) && (reg < WAVE_RAM + 16)) {
+    apu.waveRam[reg - WAVE_RAM] = value;
+    return;
+  }
+  if ((reg < NR10) || (reg > NR52)) return;
+  if (!apu.isPowered && (reg != NR52)) return;  // Only power while off
+
+  apu.regs[reg - NR10] = value;
+  int idx = (reg - NR10) / 5;
+  ApuChannel& c = apu.ch[(idx < 4) ? idx : 3];  // NR5x don't use it
+
+  switch (reg) {
+    case NR10:
+      c.sweepPeriod = (value >> 4) & 7;
+      c.isSweepDown = (value & 0x08) != 0;
+      c.sweepShift = value & 7;
+      break;
+
+    case NR11:
+    case NR21:
+      c.duty = value >> 6;
+      c.length = 64 - (value & 63);
+      break;
+    case NR31:
+      c.length = 256 - value;
+      break;
+    case NR41:
+      c.length = 64 - (value & 63);
+      break;
+
+    case NR12:
+    case NR22:
+    case NR42:
+      SetEnvelope(c, value);
+      break;
+
+    case NR30:
+      c.isDacOn = (value & 0x80) != 0;
+      if (!c.isDacOn) c.isOn = false;
+      break;
+    case NR32:
+      c.waveShift = WAVE_SHIFTS[(value >> 5) & 3];
+      break;
+
+    case NR43: {
+      int divisor = (value & 7) ? (value & 7) * 16 : 8;
+      c.isNarrow = (value & 0x08) != 0;
+      c.noisePeriod = divisor << (value >> 4);
+      break;
+    }
+
+    case NR13:
+    case NR23:
+    case NR33:
+      c.freq = (c.freq & 0x700) | value;
+      break;
+
+    case NR14:
+    case NR24:
+    case NR34:
+    case NR44:
+      if (reg != NR44) c.freq = (c.freq & 0xFF) | ((value & 7) << 8);
+      c.isLengthOn = (value & 0x40) != 0;
+      if (value & 0x80) Trigger(c, idx);
+      break;
+
+    case NR50:
+      apu.volLeft = (value >> 4) & 7;
+      apu.volRight = value & 7;
+      break;
+    case NR51:
+      apu.panning = value;
+      break;
+
+    case NR52:
+      if ((value & 0x80) == 0) {
+        PowerOff(apu);
+      } else if (!apu.isPowered) {
+        apu.isPowered = true;
+        apu.frameSeqStep = 0;
+        apu.regs[NR52 - NR10] = 0x80;
+      }
+      break;
+  }
+}
+
+uint8_t ApuRead(Apu* pApu, int reg) {
+  Apu& apu = *pApu;
+  if ((reg >= WAVE_RAM) && (reg < WAVE_RAM + 16))
+    return apu.waveRam[reg - WAVE_RAM];
+  if ((reg < NR10) || (reg > NR52)) return 0xFF;
+
+  if (reg == NR52) {
+    uint8_t status = apu.isPowered ? 0xF0 : 0x70;
+    for (int i = 0; i < 4; ++i) {
+      if (apu.ch[i].isOn) status |= 1 << i;
+    }
+    return status;
+  }
+  return apu.regs[reg - NR10];
+}
+
+static int16_t ClampSample(float v) {
+  if (v > 32767.0f) return 32767;
+  if (v < -32768.0f) return -32768;
+  return (int16_t)v;
+}
+
+void ApuRender(Apu* pApu, int16_t* out, int frames) {
+  Apu& apu = *pApu;
+  for (int f = 0; f < frames; ++f) {
+    apu.cycleFrac += apu.cyclesPerSample;
+    int cycles = (int)(apu.cycleFrac >> 16);
+    apu.cycleFrac &= 0xFFFF;
+
+    int left = 0, right = 0;
+    if (apu.isPowered) {
+      apu.frameSeqTimer -= cycles;
+      while (apu.frameSeqTimer <= 0) {
+        apu.frameSeqTimer += FRAME_SEQ_CYCLES;
+        ClockFrameSequencer(apu);
+      }
+
+      // Point sampled after the steps, plenty for chip tunes
+      for (int i = 0; i < 4; ++i) {
+        ApuChannel& c = apu.ch[i];
+        if (!c.isOn || !c.isDacOn) continue;
+
+        c.timer -= cycles;
+        while (c.timer <= 0) {
+          c.timer += ChannelPeriod(c, i);
+          StepWaveform(c, i);
+        }
+
+        int analog = ChannelOutput(apu, i) * 2 - 15;
+        if ((apu.panning >> (i + 4)) & 1) left += analog;
+        if ((apu.panning >> i) & 1) right += analog;
+      }
+      left *= apu.volLeft + 1;
+      right *= apu.volRight + 1;
+    }
+
+    float inLeft = (float)(left * MIX_SCALE);
+    float inRight = (float)(right * MIX_SCALE);
+    float outLeft = inLeft - apu.capLeft;
+    float outRight = inRight - apu.capRight;
+    apu.capLeft = inLeft - outLeft * apu.charge;
+    apu.capRight = inRight - outRight * apu.charge;
+
+    out[f * 2] = ClampSample(outLeft);
+    out[f * 2 + 1] = ClampSample(outRight);
+  }
+}
+
+/////// GAME SOUNDS
+
+struct RegWrite {
+  int reg;
+  uint8_t value;
+};
+
+// Rising blip on pulse 1, the sweep runs it off the top
+const RegWrite SND_JUMP_REGS[] = {
+    {NR10, 0x24}, {NR11, 0x80}, {NR12, 0x83}, {NR13, 0x40}, {NR14, 0x86}};
+
+// Short thump of low noise
+const RegWrite SND_LAND_REGS[] = {
+    {NR41, 0x30}, {NR42, 0x71}, {NR43, 0x64}, {NR44, 0xC0}};
+
+// Quick high chirp on pulse 2
+const RegWrite SND_POUNCE_REGS[] = {
+    {NR21, 0x40}, {NR22, 0xA1}, {NR23, 0x80}, {NR24, 0x87}};
+
+// Hiss and a low growl on the wave channel
+const RegWrite SND_FIGHT_REGS[] = {
+    {NR41, 0x00}, {NR42, 0xF2}, {NR43, 0x22}, {NR44, 0xC0},
+    {NR30, 0x80}, {NR31, 0xC0}, {NR32, 0x20}, {NR33, 0x00}, {NR34, 0xC5}};
+
+#define SOUND(regs) {regs, sizeof(regs) / sizeof(RegWrite)}
+
+const struct {
+  const RegWrite* writes;
+  int count;
+} GAME_SOUNDS[SND_COUNT] = {SOUND(SND_JUMP_REGS), SOUND(SND_LAND_REGS),
+                            SOUND(SND_POUNCE_REGS), SOUND(SND_FIGHT_REGS)};
+
+void ApuPlaySound(Apu* pApu, int sound) {
+  if ((sound < 0) || (sound >= SND_COUNT)) return;
+  for (int i = 0; i < GAME_SOUNDS[sound].count; ++i) {
+    ApuWrite(pApu, GAME_SOUNDS[sound].writes[i].reg,
+             GAME_SOUNDS[sound].writes[i].value);
+  }
+}
@@ -0,0 +1,33 @@
+#pragma once
+#include <stdint.h>
+
+extern "C" {
+
+// Game Boy style sound chip: two pulse channels (the first with a frequency
+// sweep), a 32 step 4-bit wave channel and an LFSR noise channel, driven
+// through the DMG register map and clocked at the DMG's 4194304Hz. Renders
+// interleaved stereo int16 at any sample rate, never allocates after
+// ApuCreate and takes no locks, callers own the threading.
+struct Apu;
+
+enum ApuReg {
+  NR10 = 0xFF10, NR11, NR12, NR13, NR14,  // Pulse 1 sweep/duty/env/freq
+  NR21 = 0xFF16, NR22, NR23, NR24,        // Pulse 2
+  NR30 = 0xFF1A, NR31, NR32, NR33, NR34,  // Wave
+  NR41 = 0xFF20, NR42, NR43, NR44,        // Noise
+  NR50 = 0xFF24, NR51, NR52,              // Volume, panning, power
+  WAVE_RAM = 0xFF30                       // 16 bytes, two samples each
+};
+
+Apu* ApuCreate(int sampleRate);
+void ApuDestroy(Apu* pApu);
+
+void ApuWrite(Apu* pApu, int reg, uint8_t value);
+uint8_t ApuRead(Apu* pApu, int reg);
+
+// Next frames samples, 2 per frame left then right
+void ApuRender(Apu* pApu, int16_t* out, int frames);
+
+// Register writes for one of the game's GameSound effects
+void ApuPlaySound(Apu* pApu, int sound);
+};
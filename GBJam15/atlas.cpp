@@ -0,0 +1,403 @@
+#include "atlas.h"
+#include "gamestate.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const uint32_t ATLAS_MAGIC = 0x54414247;  // "GBAT"
+const uint32_t ATLAS_VERSION = 2;
+const int ATLAS_ALIGN = 64;   // Of each block in the file, a cache line
+const int ATLAS_PITCH = 64;   // Packed sheet width, so no sprite row splits
+const int ATLAS_NAME_SIZE = 24;
+
+// Written and read by the same build, as is
+struct AtlasHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t fileSize;
+  int32_t numSprites;
+  int32_t numSections;
+  int32_t numMaskRows;
+  int32_t pitch;  // Packed sprite pixels
+  int32_t height;
+  int32_t floorWidth;
+  int32_t floorHeight;
+  uint32_t spritesOffset;   // AtlasSprite[numSprites]
+  uint32_t sectionsOffset;  // AtlasSection[numSections]
+  uint32_t masksOffset;     // uint64_t[numMaskRows]
+  uint32_t pixsOffset;      // uint8_t[pitch * height]
+  uint32_t floorOffset;     // uint8_t[floorWidth * floorHeight]
+  uint32_t sourceHash;      // AtlasSourceHash of the BMPs baked
+};
+
+struct AtlasSprite {
+  Rect rect;  // In the packed pixels
+  int32_t maskFirst;
+};
+
+struct AtlasSection {
+  char name[ATLAS_NAME_SIZE];
+  int32_t first;  // Into the AtlasSprites
+  int32_t count;
+};
+
+static uint32_t AlignUp(size_t n) {
+  return (uint32_t)((n + ATLAS_ALIGN - 1) & ~(size_t)(ATLAS_ALIGN - 1));
+}
+
+// Drawn most often first, by draws per frame on the bot benchmark: the
+// laundry (~100), bins (~30), windows (~10), score (8), then whichever cat is
+// showing. Everything else follows in sheet order.
+static const char* const HOT_SECTIONS[] = {
+    "LAUNDRY",  "BIN_MID",  "BIN_TOP", "WINDOW",  "NUM",
+    "CAT_IDLE", "CAT_WALK", "CAT_UP",  "CAT_DOWN"};
+const int NUM_HOT_SECTIONS = sizeof(HOT_SECTIONS) / sizeof(const char*);
+
+static void DrawOrder(int numSprites, std::vector<int>& order) {
+  std::vector<bool> isOrdered(numSprites, false);
+  order.clear();
+  for (int h = 0; h < NUM_HOT_SECTIONS; ++h) {
+    for (int i = 0; i < NUM_SHEET_SECTIONS; ++i) {
+      const SheetSection& section = SHEET_SECTIONS[i];
+      if (strcmp(section.name, HOT_SECTIONS[h]) != 0) continue;
+      for (int k = section.base;
+           (k < section.base + section.count) && (k < numSprites); ++k) {
+        order.push_back(k);
+        isOrdered[k] = true;
+      }
+    }
+  }
+  for (int i = 0; i < numSprites; ++i) {
+    if (!isOrdered[i]) order.push_back(i);
+  }
+}
+
+// Shelves of whole cache lines, each sprite in order into the first shelf
+// tall enough with room left, so the hot sprites share the top lines
+static int PackShelves(const ListOfRect& rects, const std::vector<int>& order,
+                       std::vector<Rect>& packed) {
+  std::vector<Rect> shelves;  // x is the space used
+  int height = 0;
+  packed.resize(rects.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    const Rect& r = rects[order[i]];
+    size_t s = 0;
+    while ((s < shelves.size()) && ((shelves[s].h < r.h) ||
+                                    (shelves[s].x + r.w > ATLAS_PITCH)))
+      ++s;
+    if (s == shelves.size()) {
+      shelves.push_back(Rect{0, height, ATLAS_PITCH, r.h});
+      height += r.h;
+    }
+    packed[order[i]] = Rect{shelves[s].x, shelves[s].y, r.w, r.h};
+    shelves[s].x += r.w;
+  }
+  return height;
+}
+
+// FNV-1a over the whole file, false if it won't open
+static bool HashFile(uint32_t& h, const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (f == nullptr) return false;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    for (size_t i = 0; i < n; ++i) h = (h ^ buf[i]) * 16777619u;
+  }
+  fclose(f);
+  return true;
+}
+
+uint32_t AtlasSourceHash(const char* spriteFile, const char* floorFile) {
+  uint32_t h = 2166136261u;
+  if (!HashFile(h, spriteFile) || !HashFile(h, floorFile)) return 0;
+  return h ? h : 1;
+}
+
+static bool Bake(const GameAssets* pAssets, uint32_t sourceHash,
+                 std::vector<uint8_t>& file) {
+  const SpriteData& sprites = pAssets->sprites;
+  const BackgroundData& floor = pAssets->floor;
+  int numSprites = (int)sprites.sprRect.size();
+  for (int i = 0; i < numSprites; ++i) {
+    if (sprites.sprRect[i].w > ATLAS_PITCH) {
+      SDL_Log("Atlas: sprite %d is wider than %d", i, ATLAS_PITCH);
+      return false;
+    }
+  }
+
+  std::vector<int> order;
+  DrawOrder(numSprites, order);
+  std::vector<Rect> packed;
+  int height = PackShelves(sprites.sprRect, order, packed);
+
+  AtlasHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = ATLAS_MAGIC;
+  header.version = ATLAS_VERSION;
+  header.numSprites = numSprites;
+  header.numSections = NUM_SHEET_SECTIONS;
+  header.numMaskRows = (int)sprites.maskRows.size();
+  header.pitch = ATLAS_PITCH;
+  header.height = height;
+  header.floorWidth = floor.size.w;
+  header.floorHeight = floor.size.h;
+  header.sourceHash = sourceHash;
+  header.spritesOffset = AlignUp(sizeof(AtlasHeader));
+  header.sectionsOffset =
+      AlignUp(header.spritesOffset + numSprites * sizeof(AtlasSprite));
+  header.masksOffset = AlignUp(header.sectionsOffset +
+                               NUM_SHEET_SECTIONS * sizeof(AtlasSection));
+  header.pixsOffset =
+      AlignUp(header.masksOffset + header.numMaskRows * sizeof(uint64_t));
+  header.floorOffset = AlignUp(header.pixsOffset + ATLAS_PITCH * height);
+  header.fileSize = AlignUp(header.floorOffset + floor.size.w * floor.size.h);
+
+  file.assign(header.fileSize, 0);
+  memcpy(&file[0], &header, sizeof(header));
+
+  AtlasSprite* pSprites = (AtlasSprite*)&file[header.spritesOffset];
+  uint8_t* pixs = &file[header.pixsOffset];
+  for (int i = 0; i < numSprites; ++i) {
+    const Rect& src = sprites.sprRect[i];
+    pSprites[i].rect = packed[i];
+    pSprites[i].maskFirst = sprites.maskFirst[i];
+    for (int y = 0; y < src.h; ++y) {
+      memcpy(pixs + packed[i].x + (packed[i].y + y) * ATLAS_PITCH,
+             sprites.pixs + src.x + (src.y + y) * sprites.sprPitch, src.w);
+    }
+  }
+
+  AtlasSection* pSections = (AtlasSection*)&file[header.sectionsOffset];
+  for (int i = 0; i < NUM_SHEET_SECTIONS; ++i) {
+    strncpy(pSections[i].name, SHEET_SECTIONS[i].name, ATLAS_NAME_SIZE - 1);
+    pSections[i].first = SHEET_SECTIONS[i].base;
+    pSections[i].count = SHEET_SECTIONS[i].count;
+  }
+
+  if (header.numMaskRows > 0) {
+    memcpy(&file[header.masksOffset], &sprites.maskRows[0],
+           header.numMaskRows * sizeof(uint64_t));
+  }
+  if (floor.pixs) {
+    memcpy(&file[header.floorOffset], floor.pixs, floor.size.w * floor.size.h);
+  }
+  SDL_Log("Atlas: %d sprites in %dx%d, %d bytes", numSprites, ATLAS_PITCH,
+          height, (int)file.size());
+  return true;
+}
+
+bool AtlasWrite(const GameAssets* pAssets, uint32_t sourceHash,
+                const char* filename) {
+  std::vector<uint8_t> file;
+  if (!Bake(pAssets, sourceHash, file)) return false;
+
+  FILE* f = fopen(filename, "wb");
+  if (f == nullptr) {
+    SDL_Log("Atlas: couldn't write %s", filename);
+    return false;
+  }
+  bool isWritten = fwrite(&file[0], 1, file.size(), f) == file.size();
+  fclose(f);
+  return isWritten;
+}
+
+bool AtlasWriteSource(const GameAssets* pAssets, uint32_t sourceHash,
+                      const char* filename) {
+  std::vector<uint8_t> file;
+  if (!Bake(pAssets, sourceHash, file)) return false;
+
+  FILE* f = fopen(filename, "w");
+  if (f == nullptr) {
+    SDL_Log("Atlas: couldn't write %s", filename);
+    return false;
+  }
+  // Whole words on a cache line boundary, as a mapped file would be, keep
+  // the blocks aligned. The size is a multiple of ATLAS_ALIGN.
+  size_t numWords = file.size() / sizeof(uint64_t);
+  fprintf(f,
+          "// Generated by headless -embed from sprites.bmp and floor.bmp, "
+          "don't edit\n// Source hash %08x\n"
+          "#include \"atlas.h\"\n\n"
+          "#ifdef _MSC_VER\n"
+          "#define ATLAS_ALIGNED __declspec(align(%d))\n"
+          "#else\n"
+          "#define ATLAS_ALIGNED __attribute__((aligned(%d)))\n"
+          "#endif\n\n"
+          "extern const size_t EMBEDDED_ATLAS_SIZE = %d;\n"
+          "ATLAS_ALIGNED extern const uint64_t EMBEDDED_ATLAS[%d] = {\n",
+          sourceHash, ATLAS_ALIGN, ATLAS_ALIGN, (int)file.size(),
+          (int)numWords);
+  for (size_t i = 0; i < numWords; ++i) {
+    uint64_t word;
+    memcpy(&word, &file[i * sizeof(uint64_t)], sizeof(word));
+    fprintf(f, "%s0x%016llxull,%s", (i % 3 == 0) ? "    " : "",
+            (unsigned long long)word,
+            ((i % 3 == 2) || (i + 1 == numWords)) ? "\n" : " ");
+  }
+  fprintf(f, "};\n");
+  bool isWritten = ferror(f) == 0;
+  fclose(f);
+  return isWritten;
+}
+
+static const uint8_t* MapFile(const char* filename, size_t* pSize) {
+#ifdef _WIN32
+  HANDLE hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (hFile == INVALID_HANDLE_VALUE) return nullptr;
+  LARGE_INTEGER size;
+  HANDLE hMapping = nullptr;
+  if (GetFileSizeEx(hFile, &size))
+    hMapping = CreateFileMappingA(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  CloseHandle(hFile);
+  if (hMapping == nullptr) return nullptr;
+  const uint8_t* p =
+      (const uint8_t*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(hMapping);  // The view keeps it open
+  *pSize = (size_t)size.QuadPart;
+  return p;
+#else
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) return nullptr;
+  struct stat st;
+  void* p = MAP_FAILED;
+  if ((fstat(fd, &st) == 0) && (st.st_size > 0))
+    p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (p == MAP_FAILED) return nullptr;
+  *pSize = (size_t)st.st_size;
+  return (const uint8_t*)p;
+#endif
+}
+
+static void UnmapFile(const uint8_t* p, size_t size) {
+#ifdef _WIN32
+  UnmapViewOfFile(p);
+#else
+  munmap((void*)p, size);
+#endif
+}
+
+static const AtlasSection* FindSection(const AtlasHeader& header,
+                                       const uint8_t* base, const char* name) {
+  const AtlasSection* pSections =
+      (const AtlasSection*)(base + header.sectionsOffset);
+  for (int i = 0; i < header.numSections; ++i) {
+    if (strncmp(pSections[i].name, name, ATLAS_NAME_SIZE) == 0)
+      return &pSections[i];
+  }
+  return nullptr;
+}
+
+static bool IsValid(const AtlasHeader& header, size_t size) {
+  if ((size < sizeof(AtlasHeader)) || (header.magic != ATLAS_MAGIC) ||
+      (header.version != ATLAS_VERSION) || (header.fileSize != size))
+    return false;
+  return (header.spritesOffset + header.numSprites * sizeof(AtlasSprite) <=
+          size) &&
+         (header.sectionsOffset + header.numSections * sizeof(AtlasSection) <=
+          size) &&
+         (header.masksOffset + header.numMaskRows * sizeof(uint64_t) <=
+          size) &&
+         (header.pixsOffset + (size_t)header.pitch * header.height <= size) &&
+         (header.floorOffset +
+              (size_t)header.floorWidth * header.floorHeight <=
+          size);
+}
+
+static bool IsSpriteValid(const AtlasHeader& header, const AtlasSprite& spr) {
+  const Rect& r = spr.rect;
+  return (r.x >= 0) && (r.y >= 0) && (r.w >= 0) && (r.h >= 0) &&
+         (r.x + r.w <= header.pitch) && (r.y + r.h <= header.height) &&
+         (spr.maskFirst >= 0) &&
+         (spr.maskFirst + r.h * 2 <= header.numMaskRows);
+}
+
+// Points the assets into base, which must outlive them
+static GameAssets* Load(const uint8_t* base, size_t size,
+                        const char* filename) {
+  const AtlasHeader& header = *(const AtlasHeader*)base;
+  if (!IsValid(header, size)) {
+    SDL_Log("Atlas: %s is damaged or from another version", filename);
+    return nullptr;
+  }
+
+  GameAssets* pAssets = new GameAssets();
+  SpriteData& sprites = pAssets->sprites;
+  const AtlasSprite* pSprites =
+      (const AtlasSprite*)(base + header.spritesOffset);
+  int numSprites = 0;
+  for (int i = 0; i < NUM_SHEET_SECTIONS; ++i) {
+    int end = SHEET_SECTIONS[i].base + SHEET_SECTIONS[i].count;
+    if (end > numSprites) numSprites = end;
+  }
+  sprites.sprRect.resize(numSprites, Rect{0, 0, 0, 0});
+  sprites.maskFirst.resize(numSprites, 0);
+
+  // By name, wherever the baking put them
+  for (int i = 0; i < NUM_SHEET_SECTIONS; ++i) {
+    const SheetSection& want = SHEET_SECTIONS[i];
+    const AtlasSection* pHave = FindSection(header, base, want.name);
+    if ((pHave == nullptr) || (pHave->count < want.count) ||
+        (pHave->first < 0) ||
+        (pHave->first + want.count > header.numSprites)) {
+      SDL_Log("Atlas: %s is missing sprites for %s", filename, want.name);
+      delete pAssets;
+      return nullptr;
+    }
+    for (int k = 0; k < want.count; ++k) {
+      if (!IsSpriteValid(header, pSprites[pHave->first + k])) {
+        SDL_Log("Atlas: %s has a bad sprite in %s", filename, want.name);
+        delete pAssets;
+        return nullptr;
+      }
+      sprites.sprRect[want.base + k] = pSprites[pHave->first + k].rect;
+      sprites.maskFirst[want.base + k] = pSprites[pHave->first + k].maskFirst;
+    }
+  }
+
+  const uint64_t* pMasks = (const uint64_t*)(base + header.masksOffset);
+  sprites.maskRows.assign(pMasks, pMasks + header.numMaskRows);
+  sprites.pixs = base + header.pixsOffset;
+  sprites.sprPitch = header.pitch;
+
+  pAssets->floor.size = Rect{0, 0, header.floorWidth, header.floorHeight};
+  pAssets->floor.pixs = base + header.floorOffset;
+
+  if (!GameFinishAssets(pAssets)) {
+    delete pAssets;
+    return nullptr;
+  }
+  return pAssets;
+}
+
+GameAssets* AtlasLoad(const char* filename) {
+  size_t size = 0;
+  const uint8_t* base = MapFile(filename, &size);
+  if (base == nullptr) {
+    SDL_Log("Atlas: couldn't map %s", filename);
+    return nullptr;
+  }
+  GameAssets* pAssets = Load(base, size, filename);
+  if (pAssets == nullptr) UnmapFile(base, size);
+  return pAssets;
+}
+
+GameAssets* AtlasLoadEmbedded() {
+  return Load((const uint8_t*)EMBEDDED_ATLAS, EMBEDDED_ATLAS_SIZE,
+              "the embedded atlas");
+}
+
+uint32_t AtlasEmbeddedSourceHash() {
+  const AtlasHeader& header = *(const AtlasHeader*)EMBEDDED_ATLAS;
+  return IsValid(header, EMBEDDED_ATLAS_SIZE) ? header.sourceHash : 0;
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include "cat.h"
+#include <stddef.h>
+
+extern "C" {
+
+// Sprites and floor baked into one file that loads with a single mmap. The
+// sheet's sprites are packed edge to edge, the ones drawn every frame first,
+// in rows one cache line wide, with their rects and collision masks under
+// named sections so the file's order needn't match SPR_BASE_*. Loading
+// checks the header, copies the rects and masks (a few KB) into place and
+// points the pixels straight at the mapping, which stays for the life of
+// the process like any other GameAssets.
+
+// Of the BMPs as files, what an atlas records it was baked from so a stale
+// one can be told apart. 0 if either won't read
+uint32_t AtlasSourceHash(const char* spriteFile, const char* floorFile);
+
+// The offline step, from assets loaded the usual way out of files with
+// sourceHash
+bool AtlasWrite(const GameAssets* pAssets, uint32_t sourceHash,
+                const char* filename);
+
+// nullptr if the file is missing, from another version or lacks a section
+GameAssets* AtlasLoad(const char* filename);
+
+// The same atlas compiled into the program, so it needs no files at all.
+// embeddedassets.cpp is generated by AtlasWriteSource (headless -embed)
+// and checked in, make it again whenever the BMPs change. Until then its
+// source hash won't match theirs.
+extern const size_t EMBEDDED_ATLAS_SIZE;
+extern const uint64_t EMBEDDED_ATLAS[];
+
+bool AtlasWriteSource(const GameAssets* pAssets, uint32_t sourceHash,
+                      const char* filename);
+GameAssets* AtlasLoadEmbedded();
+uint32_t AtlasEmbeddedSourceHash();
+};
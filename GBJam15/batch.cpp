@@ -0,0 +1,78 @@
+#include "batch.h"
+#include "gamestate.h"
+#include <vector>
+#include <atomic>
+
+struct GameBatch {
+  // Contiguous states, ranges of them are stepped as jobs
+  std::vector<GameStateData> games;
+  JobSystem* pJobs;
+  int grain;
+
+  // Current step
+  ButState* inputs;
+  int numTicks;
+
+  uint64_t ticks;
+  std::atomic<uint64_t> busyCounts;
+};
+
+static void BatchRunRange(void* pData, int begin, int end) {
+  GameBatch* pBatch = (GameBatch*)pData;
+
+  Uint64 start = SDL_GetPerformanceCounter();
+  for (int i = begin; i < end; ++i) {
+    GameStateData& game = pBatch->games[i];
+    ButState& buttons = pBatch->inputs[i];
+    for (int t = 0; t < pBatch->numTicks; ++t) {
+      Tick(&game, &buttons);
+    }
+  }
+  pBatch->busyCounts += SDL_GetPerformanceCounter() - start;
+}
+
+GameBatch* BatchCreate(const GameAssets* pAssets, int numGames, uint16_t width,
+                       uint16_t height, uint32_t seed, JobSystem* pJobs) {
+  GameBatch* pBatch = new GameBatch();
+  pBatch->games.resize(numGames);
+  for (int i = 0; i < numGames; ++i) {
+    GameInit(pBatch->games[i], pAssets, width, height, seed + i);
+  }
+
+  // A few ranges per thread so stealing can even out the load
+  pBatch->pJobs = pJobs;
+  pBatch->grain = numGames / (JobSystemNumThreads(pJobs) * 4);
+  if (pBatch->grain < 1) pBatch->grain = 1;
+  pBatch->inputs = nullptr;
+  pBatch->numTicks = 0;
+  pBatch->ticks = 0;
+  pBatch->busyCounts = 0;
+
+  return pBatch;
+}
+
+void BatchDestroy(GameBatch* pBatch) { delete pBatch; }
+
+void BatchStep(GameBatch* pBatch, ButState* inputs, int numTicks) {
+  if (pBatch->games.empty() || (numTicks <= 0)) return;
+
+  pBatch->inputs = inputs;
+  pBatch->numTicks = numTicks;
+  JobParallelFor(pBatch->pJobs, BatchRunRange, pBatch, 0,
+                 (int)pBatch->games.size(), pBatch->grain);
+  pBatch->ticks += (uint64_t)numTicks * pBatch->games.size();
+}
+
+int BatchNumGames(GameBatch* pBatch) { return (int)pBatch->games.size(); }
+
+GameStateData* BatchGetGame(GameBatch* pBatch, int i) {
+  SDL_assert((i >= 0) && (i < (int)pBatch->games.size()));
+  return &pBatch->games[i];
+}
+
+void BatchGetStats(GameBatch* pBatch, uint64_t* ticks, double* busySeconds) {
+  if (ticks) *ticks = pBatch->ticks;
+  if (busySeconds)
+    *busySeconds =
+        (double)pBatch->busyCounts / (double)SDL_GetPerformanceFrequency();
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "cat.h"
+#include "jobs.h"
+
+extern "C" {
+
+struct GameBatch;
+
+// N independent games sharing one asset set, stepped together across cores
+// Game i is seeded with seed + i, steps run on pJobs
+GameBatch* BatchCreate(const GameAssets* pAssets, int numGames, uint16_t width,
+                       uint16_t height, uint32_t seed, JobSystem* pJobs);
+void BatchDestroy(GameBatch* pBatch);
+
+// inputs has one ButState per game, each game runs numTicks on that input
+void BatchStep(GameBatch* pBatch, ButState* inputs, int numTicks);
+
+int BatchNumGames(GameBatch* pBatch);
+GameStateData* BatchGetGame(GameBatch* pBatch, int i);
+
+// Ticks simulated and summed busy time of every thread, for ticks/sec per core
+void BatchGetStats(GameBatch* pBatch, uint64_t* ticks, double* busySeconds);
+};
@@ -0,0 +1,119 @@
+#include "bot.h"
+#include "gamestate.h"
+#include <limits.h>
+#include <stdlib.h>
+
+const int MOVE_TICKS = 6;
+const int WINDOW_SCORE = 1000;
+
+// Buttons held for a move, up and down are jumps and drops
+const ButState BOT_MOVES[] = {
+    {0, 0, 0, 0}, {0, 0, 1, 0}, {0, 0, 0, 1}, {1, 0, 0, 0},
+    {1, 0, 1, 0}, {1, 0, 0, 1}, {0, 1, 0, 0}};
+const int NUM_MOVES = sizeof(BOT_MOVES) / sizeof(ButState);
+
+struct PlayBot {
+  GameStateData* pFirst;  // After the first move
+  GameStateData* pLeaf;   // After the follow up
+  int move;
+  int ticksLeft;
+
+  // Stats
+  uint64_t forks;
+  uint64_t ticks;
+  Uint64 searchCounts;
+};
+
+static void HoldMove(ButState& buttons, int move) {
+  buttons = GameHeldButtons(GameButtonBits(BOT_MOVES[move]),
+                            GameButtonBits(buttons));
+}
+
+// Returns the GameSound bits raised on the way
+static uint32_t Simulate(PlayBot& bot, GameStateData* pGame,
+                         ButState& buttons, int move) {
+  uint32_t sounds = 0;
+  for (int t = 0; t < MOVE_TICKS; ++t) {
+    HoldMove(buttons, move);
+    Tick(pGame, &buttons);
+    sounds |= GameTakeSounds(pGame);
+  }
+  bot.ticks += MOVE_TICKS;
+  return sounds;
+}
+
+// Into a window beats everything, otherwise closer to the open one is better
+static int Score(const GameStateData& game, uint32_t sounds) {
+  // Cat position, bottom centre, that puts it in the middle of the window
+  Rect window = WindowRect(game, game.activeWindow);
+  int windowX = window.x + window.w / 2;
+  int windowY = window.y + 2;
+
+  int score = -abs(game.cat.pos.x - windowX) - abs(game.cat.pos.y - windowY);
+  if ((sounds >> SND_FIGHT) & 1) score += WINDOW_SCORE;
+  return score;
+}
+
+static void Search(PlayBot& bot, GameStateData* pGameState,
+                   const ButState& buttons) {
+  Uint64 start = SDL_GetPerformanceCounter();
+  int bestScore = INT_MIN;
+  int bestMove = 0;
+
+  for (int first = 0; first < NUM_MOVES; ++first) {
+    GameForkInto(bot.pFirst, pGameState);
+    ++bot.forks;
+    ButState firstButtons = buttons;
+    uint32_t firstSounds = Simulate(bot, bot.pFirst, firstButtons, first);
+
+    for (int next = 0; next < NUM_MOVES; ++next) {
+      GameForkInto(bot.pLeaf, bot.pFirst);
+      ++bot.forks;
+      ButState leafButtons = firstButtons;
+      uint32_t sounds =
+          firstSounds | Simulate(bot, bot.pLeaf, leafButtons, next);
+
+      int score = Score(*bot.pLeaf, sounds);
+      if (score > bestScore) {
+        bestScore = score;
+        bestMove = first;
+      }
+    }
+  }
+
+  bot.move = bestMove;
+  bot.ticksLeft = MOVE_TICKS;
+  bot.searchCounts += SDL_GetPerformanceCounter() - start;
+}
+
+PlayBot* BotCreate(GameStateData* pGameState) {
+  PlayBot* pBot = new PlayBot();
+  pBot->pFirst = GameFork(pGameState);
+  pBot->pLeaf = GameFork(pGameState);
+  pBot->move = 0;
+  pBot->ticksLeft = 0;
+  pBot->forks = 0;
+  pBot->ticks = 0;
+  pBot->searchCounts = 0;
+  return pBot;
+}
+
+void BotDestroy(PlayBot* pBot) {
+  GameDestroy(pBot->pFirst);
+  GameDestroy(pBot->pLeaf);
+  delete pBot;
+}
+
+void BotThink(PlayBot* pBot, GameStateData* pGameState, ButState* buttons) {
+  if (pBot->ticksLeft <= 0) Search(*pBot, pGameState, *buttons);
+  --pBot->ticksLeft;
+  HoldMove(*buttons, pBot->move);
+}
+
+void BotGetStats(PlayBot* pBot, uint64_t* pForks, uint64_t* pTicks,
+                 double* pSearchSeconds) {
+  *pForks = pBot->forks;
+  *pTicks = pBot->ticks;
+  *pSearchSeconds =
+      (double)pBot->searchCounts / (double)SDL_GetPerformanceFrequency();
+}
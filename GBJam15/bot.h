@@ -0,0 +1,21 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Playtesting bot. When its current move runs out it forks the game once
+// per move it could make and again per follow up move, simulates each pair
+// ahead and plays the first move of the best pair. Pairs score for getting
+// into a window, then for getting close to the open one.
+struct PlayBot;
+
+// Allocates its forks of pGameState up front, searching doesn't allocate
+PlayBot* BotCreate(GameStateData* pGameState);
+void BotDestroy(PlayBot* pBot);
+
+// Sets the buttons to hold for the next Tick, like a player would
+void BotThink(PlayBot* pBot, GameStateData* pGameState, ButState* buttons);
+
+void BotGetStats(PlayBot* pBot, uint64_t* pForks, uint64_t* pTicks,
+                 double* pSearchSeconds);
+};
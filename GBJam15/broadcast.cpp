@@ -0,0 +1,614 @@
+#include "broadcast.h"
+#include "cat.h"
+#include "sockets.h"
+#include <deque>
+#include <memory>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+
+const int TILE_SIZE = 8;
+const int MAX_SHIFT = 8;  // Camera movement searched for, pixels per frame
+const int SHIFT_ROW_STEP = 4;
+const int MAX_VIEWERS = 64;
+const size_t MAX_VIEWER_BACKLOG = 256 * 1024;
+
+// Messages are a 4 byte size (including this header), a type, then
+//   KEY:   tiles wide, tiles high, 4 RGB444 colours, coded frame
+//   DELTA: shift x, shift y, coded frame
+const int MSG_HEADER_SIZE = 5;
+const uint8_t MSG_KEY = 1;
+const uint8_t MSG_DELTA = 2;
+
+typedef std::vector<uint8_t> Buffer;
+typedef std::shared_ptr<const Buffer> SharedBuffer;
+
+static void PutU32(Buffer& out, size_t at, uint32_t v) {
+  for (int i = 0; i < 4; ++i) out[at + i] = (uint8_t)(v >> (i * 8));
+}
+
+static uint32_t GetU32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/////// RANGE CODER
+// Binary adaptive range coder as in LZMA, 11-bit probabilities of a 0
+
+const int PROB_BITS = 11;
+const uint16_t PROB_HALF = 1 << (PROB_BITS - 1);
+const int PROB_MOVE_BITS = 5;
+const uint32_t RANGE_TOP = 1 << 24;
+
+struct RangeEncoder {
+  Buffer* pOut;
+  uint64_t low;
+  uint32_t range;
+  uint8_t cache;
+  uint64_t cacheSize;
+
+  explicit RangeEncoder(Buffer* pOut)
+      : pOut(pOut), low(0), range(0xFFFFFFFF), cache(0), cacheSize(1) {}
+
+  void ShiftLow() {
+    if ((uint32_t)low < 0xFF000000u || (low >> 32) != 0) {
+      uint8_t carry = (uint8_t)(low >> 32);
+      uint8_t temp = cache;
+      do {
+        pOut->push_back(temp + carry);
+        temp = 0xFF;
+      } while (--cacheSize != 0);
+      cache = (uint8_t)(low >> 24);
+    }
+    ++cacheSize;
+    low = (low & 0x00FFFFFF) << 8;
+  }
+
+  int Bit(uint16_t& prob, int bit) {
+    uint32_t bound = (range >> PROB_BITS) * prob;
+    if (bit == 0) {
+      range = bound;
+      prob += ((1 << PROB_BITS) - prob) >> PROB_MOVE_BITS;
+    } else {
+      low += bound;
+      range -= bound;
+      prob -= prob >> PROB_MOVE_BITS;
+    }
+    while (range < RANGE_TOP) {
+      range <<= 8;
+      ShiftLow();
+    }
+    return bit;
+  }
+
+  void Flush() {
+    for (int i = 0; i < 5; ++i) ShiftLow();
+  }
+};
+
+// Reads zeros past the end, a truncated frame decodes to garbage not a crash
+struct RangeDecoder {
+  const uint8_t* p;
+  const uint8_t* end;
+  uint32_t range;
+  uint32_t code;
+
+  RangeDecoder(const uint8_t* p, const uint8_t* end)
+      : p(p), end(end), range(0xFFFFFFFF), code(0) {
+    for (int i = 0; i < 5; ++i) code = (code << 8) | Next();
+  }
+
+  uint8_t Next() { return (p < end) ? *p++ : 0; }
+
+  int Bit(uint16_t& prob, int) {
+    uint32_t bound = (range >> PROB_BITS) * prob;
+    int bit;
+    if (code < bound) {
+      range = bound;
+      prob += ((1 << PROB_BITS) - prob) >> PROB_MOVE_BITS;
+      bit = 0;
+    } else {
+      code -= bound;
+      range -= bound;
+      prob -= prob >> PROB_MOVE_BITS;
+      bit = 1;
+    }
+    while (range < RANGE_TOP) {
+      range <<= 8;
+      code = (code << 8) | Next();
+    }
+    return bit;
+  }
+};
+
+/////// FRAME CODEC
+// Frames are one palette index per pixel. The prediction is the last frame
+// shifted by the camera move; tiles equal to it cost a bit, the rest code
+// each pixel in the context of its prediction and left and up neighbours.
+
+struct FrameModel {
+  uint16_t tileProbs[2];      // By whether the last tile changed
+  uint16_t pixelProbs[64][3];  // By context, high bit then low bit
+
+  FrameModel() {
+    tileProbs[0] = tileProbs[1] = PROB_HALF;
+    for (int c = 0; c < 64; ++c)
+      pixelProbs[c][0] = pixelProbs[c][1] = pixelProbs[c][2] = PROB_HALF;
+  }
+};
+
+// Shared by both ends so they can't disagree. Encoding, cur is the frame
+// and changed says which tiles differ from pred. Decoding, cur starts as a
+// copy of pred and both are filled in.
+template <typename Coder>
+static void CodeFrame(Coder& coder, uint8_t* cur, const uint8_t* pred,
+                      uint8_t* changed, int width, int height, bool isKey) {
+  FrameModel model;
+  int tilesW = width / TILE_SIZE;
+  int tilesH = height / TILE_SIZE;
+  int lastChanged = 0;
+
+  for (int t = 0; t < tilesW * tilesH; ++t) {
+    if (!isKey) changed[t] = (uint8_t)coder.Bit(model.tileProbs[lastChanged],
+                                                changed[t]);
+    lastChanged = changed[t];
+    if (!changed[t]) continue;
+
+    int x0 = (t % tilesW) * TILE_SIZE;
+    int y0 = (t / tilesW) * TILE_SIZE;
+    for (int y = y0; y < y0 + TILE_SIZE; ++y) {
+      for (int x = x0; x < x0 + TILE_SIZE; ++x) {
+        int i = x + y * width;
+        int left = (x > 0) ? cur[i - 1] : 0;
+        int up = (y > 0) ? cur[i - width] : 0;
+        uint16_t* probs = model.pixelProbs[pred[i] * 16 + left * 4 + up];
+        int hi = coder.Bit(probs[0], cur[i] >> 1);
+        int lo = coder.Bit(probs[1 + hi], cur[i] & 1);
+        cur[i] = (uint8_t)(hi * 2 + lo);
+      }
+    }
+  }
+}
+
+// Last frame moved by (dx, dy), edges smeared in
+static void ShiftFrame(uint8_t* pred, const uint8_t* last, int width,
+                       int height, int dx, int dy) {
+  for (int y = 0; y < height; ++y) {
+    int sy = y + dy;
+    sy = (sy < 0) ? 0 : (sy >= height) ? height - 1 : sy;
+    for (int x = 0; x < width; ++x) {
+      int sx = x + dx;
+      sx = (sx < 0) ? 0 : (sx >= width) ? width - 1 : sx;
+      pred[x + y * width] = last[sx + sy * width];
+    }
+  }
+}
+
+// Pixels that differ with last shifted by (dx, dy), sampled rows only
+static int ShiftCost(const uint8_t* cur, const uint8_t* last, int width,
+                     int height, int dx, int dy) {
+  int cost = 0;
+  int x0 = (dx < 0) ? -dx : 0;
+  int x1 = (dx > 0) ? width - dx : width;
+  int y0 = (dy < 0) ? -dy : 0;
+  int y1 = (dy > 0) ? height - dy : height;
+  for (int y = y0; y < y1; y += SHIFT_ROW_STEP) {
+    const uint8_t* a = cur + y * width;
+    const uint8_t* b = last + (y + dy) * width + dx;
+    for (int x = x0; x < x1; ++x) cost += (a[x] != b[x]);
+  }
+  // Uncovered edges are mostly guesses
+  cost += (abs(dx) * height + abs(dy) * width) / (4 * SHIFT_ROW_STEP);
+  return cost;
+}
+
+// Camera moves are rarely diagonal for long, search one axis then the other.
+// Most frames it's still or moving as it was, so try those first.
+static void FindShift(const uint8_t* cur, const uint8_t* last, int width,
+                      int height, int& dx, int& dy) {
+  int good = width * height / (64 * SHIFT_ROW_STEP);
+  int lastDx = dx, lastDy = dy;
+  dx = dy = 0;
+  int best = ShiftCost(cur, last, width, height, 0, 0);
+  if (best <= good) return;
+  if ((lastDx != 0) || (lastDy != 0)) {
+    int cost = ShiftCost(cur, last, width, height, lastDx, lastDy);
+    if (cost <= good) {
+      dx = lastDx;
+      dy = lastDy;
+      return;
+    }
+  }
+
+  for (int x = -MAX_SHIFT; x <= MAX_SHIFT; ++x) {
+    int cost = ShiftCost(cur, last, width, height, x, 0);
+    if (cost < best) {
+      best = cost;
+      dx = x;
+    }
+  }
+  int bestX = dx;
+  for (int y = -MAX_SHIFT; y <= MAX_SHIFT; ++y) {
+    if (y == 0) continue;
+    int cost = ShiftCost(cur, last, width, height, bestX, y);
+    if (cost < best) {
+      best = cost;
+      dy = y;
+    }
+  }
+}
+
+/////// SERVER
+
+struct Viewer {
+  NetSocket sock;
+  std::deque<SharedBuffer> queue;
+  size_t sentOfFront;
+  size_t queuedBytes;
+  bool needsKey;
+  bool isDead;
+};
+
+struct BroadcastServer {
+  NetSocket listenSock;
+  int width, height;
+  uint8_t toIndex[4096];  // RGB444 to palette index
+
+  std::vector<uint8_t> cur, last, pred, zeros, changed;
+  bool hasLast;
+  int shiftX, shiftY;  // Last frame's camera move
+  std::vector<Viewer> viewers;
+
+  BroadcastStats stats;
+};
+
+static SharedBuffer EncodeKey(BroadcastServer& s) {
+  Buffer* pOut = new Buffer(MSG_HEADER_SIZE);
+  Buffer& out = *pOut;
+  out[4] = MSG_KEY;
+  out.push_back((uint8_t)(s.width / TILE_SIZE));
+  out.push_back((uint8_t)(s.height / TILE_SIZE));
+  for (int i = 0; i < 4; ++i) {
+    uint16_t col = GamePaletteColour(i);
+    out.push_back((uint8_t)col);
+    out.push_back((uint8_t)(col >> 8));
+  }
+
+  std::vector<uint8_t> frame(s.cur);
+  memset(&s.changed[0], 1, s.changed.size());
+  RangeEncoder coder(pOut);
+  CodeFrame(coder, &frame[0], &s.zeros[0], &s.changed[0], s.width, s.height,
+            true);
+  coder.Flush();
+  PutU32(out, 0, (uint32_t)out.size());
+  return SharedBuffer(pOut);
+}
+
+// Nothing if the picture didn't change
+static SharedBuffer EncodeDelta(BroadcastServer& s) {
+  int& dx = s.shiftX;
+  int& dy = s.shiftY;
+  FindShift(&s.cur[0], &s.last[0], s.width, s.height, dx, dy);
+  ShiftFrame(&s.pred[0], &s.last[0], s.width, s.height, dx, dy);
+
+  int tilesW = s.width / TILE_SIZE;
+  bool anyChanged = false;
+  for (size_t t = 0; t < s.changed.size(); ++t) {
+    int x0 = (t % tilesW) * TILE_SIZE;
+    int y0 = (t / tilesW) * TILE_SIZE;
+    bool isChanged = false;
+    for (int y = y0; (y < y0 + TILE_SIZE) && !isChanged; ++y) {
+      int i = x0 + y * s.width;
+      isChanged = memcmp(&s.cur[i], &s.pred[i], TILE_SIZE) != 0;
+    }
+    s.changed[t] = isChanged;
+    anyChanged = anyChanged || isChanged;
+  }
+  if (!anyChanged && (dx == 0) && (dy == 0)) return SharedBuffer();
+
+  Buffer* pOut = new Buffer(MSG_HEADER_SIZE);
+  Buffer& out = *pOut;
+  out[4] = MSG_DELTA;
+  out.push_back((uint8_t)(int8_t)dx);
+  out.push_back((uint8_t)(int8_t)dy);
+
+  RangeEncoder coder(pOut);
+  CodeFrame(coder, &s.cur[0], &s.pred[0], &s.changed[0], s.width, s.height,
+            false);
+  coder.Flush();
+  PutU32(out, 0, (uint32_t)out.size());
+  return SharedBuffer(pOut);
+}
+
+static void AcceptViewers(BroadcastServer& s) {
+  for (;;) {
+    NetSocket sock = accept(s.listenSock, nullptr, nullptr);
+    if (sock == INVALID_SOCKET) return;
+    if ((int)s.viewers.size() >= MAX_VIEWERS) {
+      SockClose(sock);
+      continue;
+    }
+    SockSetNonBlocking(sock);
+    int noDelay = 1;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay,
+               sizeof(noDelay));
+
+    Viewer viewer;
+    viewer.sock = sock;
+    viewer.sentOfFront = 0;
+    viewer.queuedBytes = 0;
+    viewer.needsKey = true;
+    viewer.isDead = false;
+    s.viewers.push_back(viewer);
+    SDL_Log("Broadcast: viewer %d joined", (int)s.viewers.size());
+  }
+}
+
+// Sends until the socket is full, the only per viewer work
+static void FlushViewer(BroadcastServer& s, Viewer& v) {
+  while (!v.queue.empty()) {
+    const Buffer& msg = *v.queue.front();
+    int n = (int)send(v.sock, (const char*)&msg[v.sentOfFront],
+                      (int)(msg.size() - v.sentOfFront), MSG_NOSIGNAL);
+    if (n <= 0) {
+      if ((n < 0) && SockWouldBlock()) break;
+      v.isDead = true;
+      return;
+    }
+    v.sentOfFront += n;
+    s.stats.bytesSent += n;
+    if (v.sentOfFront == msg.size()) {
+      v.queuedBytes -= msg.size();
+      v.queue.pop_front();
+      v.sentOfFront = 0;
+    }
+  }
+
+  // Too far behind, keep the message on the wire whole and start again
+  if (v.queuedBytes > MAX_VIEWER_BACKLOG) {
+    SharedBuffer partial = (v.sentOfFront > 0) ? v.queue.front() : nullptr;
+    v.queue.clear();
+    v.queuedBytes = 0;
+    if (partial) {
+      v.queue.push_back(partial);
+      v.queuedBytes = partial->size();
+    }
+    v.needsKey = true;
+    s.stats.viewersDropped++;
+  }
+}
+
+static void RemoveDeadViewers(BroadcastServer& s) {
+  for (size_t i = 0; i < s.viewers.size();) {
+    if (s.viewers[i].isDead) {
+      SockClose(s.viewers[i].sock);
+      s.viewers.erase(s.viewers.begin() + i);
+      SDL_Log("Broadcast: viewer left, %d watching", (int)s.viewers.size());
+    } else {
+      ++i;
+    }
+  }
+}
+
+BroadcastServer* BroadcastCreate(int port, int width, int height) {
+  if ((width % TILE_SIZE) || (height % TILE_SIZE)) return nullptr;
+  if (!SockStartup()) return nullptr;
+
+  NetSocket sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (sock == INVALID_SOCKET) {
+    SockShutdown();
+    return nullptr;
+  }
+  int reuse = 1;
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse,
+             sizeof(reuse));
+  sockaddr_in addr;
+  SockAddress(addr, nullptr, port);
+  if ((bind(sock, (const sockaddr*)&addr, sizeof(addr)) != 0) ||
+      (listen(sock, 8) != 0)) {
+    SDL_Log("Broadcast: couldn't listen on port %d", port);
+    SockClose(sock);
+    SockShutdown();
+    return nullptr;
+  }
+  SockSetNonBlocking(sock);
+
+  BroadcastServer* pServer = new BroadcastServer();
+  BroadcastServer& s = *pServer;
+  s.listenSock = sock;
+  s.width = width;
+  s.height = height;
+  GamePaletteIndexTable(s.toIndex);
+  s.cur.resize(width * height);
+  s.last.resize(width * height);
+  s.pred.resize(width * height);
+  s.zeros.resize(width * height, 0);
+  s.changed.resize((width / TILE_SIZE) * (height / TILE_SIZE));
+  s.hasLast = false;
+  s.shiftX = s.shiftY = 0;
+  memset(&s.stats, 0, sizeof(s.stats));
+  return pServer;
+}
+
+void BroadcastDestroy(BroadcastServer* pServer) {
+  if (pServer == nullptr) return;
+  for (size_t i = 0; i < pServer->viewers.size(); ++i)
+    SockClose(pServer->viewers[i].sock);
+  SockClose(pServer->listenSock);
+  SockShutdown();
+  delete pServer;
+}
+
+void BroadcastFrame(BroadcastServer* pServer, const uint16_t* pixs) {
+  BroadcastServer& s = *pServer;
+  AcceptViewers(s);
+  s.stats.frames++;
+  s.stats.rawBytes += s.width * s.height * sizeof(uint16_t);
+
+  // Encode once for everyone
+  Uint64 start = SDL_GetPerformanceCounter();
+  for (int i = 0; i < s.width * s.height; ++i)
+    s.cur[i] = s.toIndex[pixs[i] & 0xFFF];
+
+  bool wantKey = false, wantDelta = false;
+  for (size_t i = 0; i < s.viewers.size(); ++i) {
+    wantKey = wantKey || s.viewers[i].needsKey;
+    wantDelta = wantDelta || !s.viewers[i].needsKey;
+  }
+  SharedBuffer key, delta;
+  if (wantKey) {
+    key = EncodeKey(s);
+    s.stats.keyFrames++;
+    s.stats.bytesEncoded += key->size();
+  }
+  if (wantDelta && s.hasLast) {
+    delta = EncodeDelta(s);
+    if (delta) s.stats.bytesEncoded += delta->size();
+  }
+  Uint64 encoded = SDL_GetPerformanceCounter();
+  s.stats.encodeSeconds +=
+      (double)(encoded - start) / (double)SDL_GetPerformanceFrequency();
+
+  // Queue and send
+  for (size_t i = 0; i < s.viewers.size(); ++i) {
+    Viewer& v = s.viewers[i];
+    const SharedBuffer& msg = v.needsKey ? key : delta;
+    if (msg) {
+      v.queue.push_back(msg);
+      v.queuedBytes += msg->size();
+    }
+    v.needsKey = false;
+    FlushViewer(s, v);
+  }
+  RemoveDeadViewers(s);
+  s.stats.sendSeconds += (double)(SDL_GetPerformanceCounter() - encoded) /
+                         (double)SDL_GetPerformanceFrequency();
+
+  s.cur.swap(s.last);
+  s.hasLast = true;
+}
+
+size_t BroadcastFlush(BroadcastServer* pServer) {
+  BroadcastServer& s = *pServer;
+  for (size_t i = 0; i < s.viewers.size(); ++i) FlushViewer(s, s.viewers[i]);
+  RemoveDeadViewers(s);
+
+  size_t waiting = 0;
+  for (size_t i = 0; i < s.viewers.size(); ++i)
+    waiting += s.viewers[i].queuedBytes - s.viewers[i].sentOfFront;
+  return waiting;
+}
+
+int BroadcastNumViewers(BroadcastServer* pServer) {
+  AcceptViewers(*pServer);
+  return (int)pServer->viewers.size();
+}
+
+void BroadcastGetStats(BroadcastServer* pServer, BroadcastStats* pStats) {
+  *pStats = pServer->stats;
+  pStats->viewers = (int)pServer->viewers.size();
+}
+
+/////// VIEWER
+
+struct BroadcastView {
+  NetSocket sock;
+  Buffer inbox;
+  int width, height;
+  uint16_t palette[4];
+  std::vector<uint8_t> frame, pred, changed;
+  bool hasKey;
+};
+
+BroadcastView* BroadcastConnect(const char* host, int port) {
+  sockaddr_in addr;
+  if (!SockAddress(addr, host, port)) return nullptr;
+  if (!SockStartup()) return nullptr;
+
+  NetSocket sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if ((sock == INVALID_SOCKET) ||
+      (connect(sock, (const sockaddr*)&addr, sizeof(addr)) != 0)) {
+    SDL_Log("Broadcast: couldn't connect to %s:%d", host, port);
+    if (sock != INVALID_SOCKET) SockClose(sock);
+    SockShutdown();
+    return nullptr;
+  }
+  SockSetNonBlocking(sock);
+
+  BroadcastView* pView = new BroadcastView();
+  pView->sock = sock;
+  pView->width = pView->height = 0;
+  pView->hasKey = false;
+  return pView;
+}
+
+void BroadcastDisconnect(BroadcastView* pView) {
+  if (pView == nullptr) return;
+  SockClose(pView->sock);
+  SockShutdown();
+  delete pView;
+}
+
+static bool DecodeMessage(BroadcastView& v, const uint8_t* msg, int size) {
+  const uint8_t* end = msg + size;
+  if (msg[4] == MSG_KEY) {
+    if (size < MSG_HEADER_SIZE + 10) return false;
+    v.width = msg[5] * TILE_SIZE;
+    v.height = msg[6] * TILE_SIZE;
+    for (int i = 0; i < 4; ++i)
+      v.palette[i] = (uint16_t)(msg[7 + i * 2] | (msg[8 + i * 2] << 8));
+    v.frame.assign(v.width * v.height, 0);
+    v.pred.assign(v.width * v.height, 0);
+    v.changed.assign((v.width / TILE_SIZE) * (v.height / TILE_SIZE), 1);
+
+    RangeDecoder coder(msg + MSG_HEADER_SIZE + 10, end);
+    CodeFrame(coder, &v.frame[0], &v.pred[0], &v.changed[0], v.width,
+              v.height, true);
+    v.hasKey = true;
+    return true;
+  }
+
+  if ((msg[4] != MSG_DELTA) || !v.hasKey || (size < MSG_HEADER_SIZE + 2))
+    return false;
+  int dx = (int8_t)msg[5];
+  int dy = (int8_t)msg[6];
+  ShiftFrame(&v.pred[0], &v.frame[0], v.width, v.height, dx, dy);
+  v.frame = v.pred;
+  RangeDecoder coder(msg + MSG_HEADER_SIZE + 2, end);
+  CodeFrame(coder, &v.frame[0], &v.pred[0], &v.changed[0], v.width, v.height,
+            false);
+  return true;
+}
+
+bool BroadcastReceive(BroadcastView* pView, uint16_t* pixs, int width,
+                      int height, bool* pHasFrame) {
+  BroadcastView& v = *pView;
+  *pHasFrame = false;
+
+  uint8_t buf[16384];
+  bool isOpen = true;
+  for (;;) {
+    int n = (int)recv(v.sock, (char*)buf, sizeof(buf), 0);
+    if (n > 0) {
+      v.inbox.insert(v.inbox.end(), buf, buf + n);
+    } else {
+      isOpen = (n < 0) && SockWouldBlock();
+      break;
+    }
+  }
+
+  size_t at = 0;
+  while (v.inbox.size() - at >= (size_t)MSG_HEADER_SIZE) {
+    uint32_t size = GetU32(&v.inbox[at]);
+    if (size < (uint32_t)MSG_HEADER_SIZE) return false;
+    if (v.inbox.size() - at < size) break;
+    if (DecodeMessage(v, &v.inbox[at], (int)size)) *pHasFrame = true;
+    at += size;
+  }
+  v.inbox.erase(v.inbox.begin(), v.inbox.begin() + at);
+
+  if (*pHasFrame) {
+    if ((v.width != width) || (v.height != height)) return false;
+    for (int i = 0; i < width * height; ++i) pixs[i] = v.palette[v.frame[i]];
+  }
+  return isOpen;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+extern "C" {
+
+// Spectator broadcast over TCP. Each frame is reduced to the game's 4
+// colours, compared with the last one shifted by however far the camera
+// moved, and only the 8x8 tiles that still differ are sent, range coded
+// with each pixel predicted from its neighbours and the shifted old frame.
+// A frame is encoded once and the same buffer queued for every viewer;
+// new viewers, and ones too far behind to catch up, get a key frame.
+struct BroadcastServer;
+
+struct BroadcastStats {
+  uint64_t frames;
+  uint64_t keyFrames;    // Encoded, shared by whoever needed one
+  uint64_t bytesEncoded;
+  uint64_t bytesSent;    // Over all viewers
+  uint64_t rawBytes;     // What the frames were as RGB444
+  double encodeSeconds;
+  double sendSeconds;
+  int viewers;
+  int viewersDropped;    // Fell behind and were restarted from a key frame
+};
+
+// Listens on port, frames are width x height RGB444
+BroadcastServer* BroadcastCreate(int port, int width, int height);
+void BroadcastDestroy(BroadcastServer* pServer);
+
+// Takes new viewers, encodes and sends what it can without blocking
+void BroadcastFrame(BroadcastServer* pServer, const uint16_t* pixs);
+
+// Sends what it can of what's queued, returns the bytes still waiting
+size_t BroadcastFlush(BroadcastServer* pServer);
+
+// Takes new viewers too, so can be polled while waiting for some
+int BroadcastNumViewers(BroadcastServer* pServer);
+void BroadcastGetStats(BroadcastServer* pServer, BroadcastStats* pStats);
+
+// Viewer end
+struct BroadcastView;
+
+BroadcastView* BroadcastConnect(const char* host, int port);
+void BroadcastDisconnect(BroadcastView* pView);
+
+// Decodes everything that arrived into pixs, the newest frame wins.
+// Returns false once the server has gone.
+bool BroadcastReceive(BroadcastView* pView, uint16_t* pixs, int width,
+                      int height, bool* pHasFrame);
+};
@@ -1,11 +1,13 @@
 #include "cat.h"
+#include "collision.h"
+#include "gamestate.h"
+#include "jobs.h"
+#include "particles.h"
+#include "timerwheel.h"
 #include <vector>
 #include <algorithm>
 #include <random>
 
-typedef std::vector<Pt> ListOfPt;
-typedef std::vector<Rect> ListOfRect;
-
 ////// CONSTS
 const uint16_t GBAColours[4] = {0x141, 0x363, 0x9B1, 0xAC1};
 const int FLOOR_HEIGHT = 5;
@@ -18,117 +20,103 @@ const int CAT_SMALL_JUMP_FRAMES = 9;
 const int CAMERA_LEFT_BOUND = 50;
 const int CAMERA_RIGHT_BOUND = 60;
 const int WINDOW_OPEN_TIME = 120;
-
-///////// SPRITE SHEET DATA
-int SPR_COUNT = 0;
-int SPR_NUM[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
-int SPR_MOUSE_IDLE[] = {0};
-int SPR_MOUSE_RUN[] = {0, 1};
-int SPR_FOOD[] = {0, 1};
-int SPR_WINDOW_CAT[] = {0, 2, 4, 6, 8, 10};
-int SPR_WINDOW_EMPTY[] = {1, 3, 5, 7, 9, 11};
-int SPR_SQUEEK[] = {0};
-int SPR_BIN_MID[] = {0};
-int SPR_BIN_TOP[] = {0};
-int SPR_CAT_IDLE[] = {0, 1, 2, 3, 4, 5, 6, 7};
-int SPR_CAT_WALK[] = {0, 1, 2, 3};
-int SPR_CAT_UP[] = {0};
-int SPR_CAT_HOLD[] = {0};
-int SPR_CAT_DOWN[] = {0};
-int SPR_CAT_1[] = {0};
-int SPR_CAT_POUNCE[] = {0};
-int SPR_CAT_POUNCE_DOWN[] = {0, 1};
-int SPR_DOG[] = {0, 1};
-int SPR_FIGHT[] = {0, 1, 2};
-int SPR_LAUNDRY[] = {0, 1, 2, 3};
-
-int LAUNDRY_WIDTH[] = {5, 5, 5, 5};
-
-//// STATE
-
-struct CatData {
-  enum CState {
-    Idle,
-    Left,
-    Right,
-    Down,
-    DownLeft,
-    DownRight,
-    Up,
-    PounceLeft,
-    PounceRight,
-    Hold
-  } state;
-  Pt pos;
-  Pt holdPos;
-  int framesRunning;
-  int upFrames;
-  int dontLandForFrames;
-  bool isRunning;
-  bool isGrounded;
-};
-
-struct SpriteData {
-  enum Anchor {
-    TOP_LEFT,
-    TOP,
-    TOP_RIGHT,
-    LEFT,
-    MIDDLE,
-    RIGHT,
-    BOTTOM_LEFT,
-    BOTTOM,
-    BOTTOM_RIGHT
-  };
-  uint8_t* pixs;
-  int sprPitch;
-  ListOfRect sprRect;
-};
-
-struct BackgroundData {
-  uint8_t* pixs;
-  Rect size;
-};
-
-struct PixData {
-  uint16_t* pixs;
-  Rect size;
-
-  int GetI(const Pt& p) const;
-};
-
-struct LaundryData {
-  int xStep;
-  int laundryType;
-};
-
-struct LaundryLineData {
-  int offset;
-  int scrollDir;
-  int lineHeight;
-  std::vector<LaundryData> laundry;
+const int BIN_WIDTH = 27;
+const int LINE_MOVE_FRAMES = 20;
+const int LINE_REST_FRAMES = 21;
+const int DROP_THROUGH_FRAMES = 3;
+
+// What a timer does when it fires
+enum TimerEvent {
+  EVT_WINDOW_CLOSE,
+  EVT_LINE_START,
+  EVT_LINE_STOP,
+  EVT_CAT_CAN_LAND
 };
 
-struct GameStateData {
-  int screen_width, screen_height;
-  CatData cat;
-  SpriteData sprites;
-  BackgroundData floor;
-  Pt scrollPoint;
-  Rect level_bounds;
-  std::mt19937 randGen;
-
-  // Alley
-  ListOfRect bins;
-  LaundryLineData* lines;
-  int movingLine;
-  int movingLineFrames;
-  bool isMeowUnlocked;
-  int activeWindow;
-  int windowOpenTime;
+///////// SPRITE SHEET DATA
+// Sheet sections in scan order, each base is the previous plus its count
+enum SprSheetBase {
+  SPR_BASE_NUM = 0,
+  SPR_BASE_MOUSE_IDLE = SPR_BASE_NUM + 11,
+  SPR_BASE_MOUSE_RUN = SPR_BASE_MOUSE_IDLE + 1,
+  SPR_BASE_FOOD = SPR_BASE_MOUSE_RUN + 2,
+  SPR_BASE_WINDOW = SPR_BASE_FOOD + 2,
+  SPR_BASE_SQUEEK = SPR_BASE_WINDOW + 12,
+  SPR_BASE_BIN_MID = SPR_BASE_SQUEEK + 1,
+  SPR_BASE_BIN_TOP = SPR_BASE_BIN_MID + 1,
+  SPR_BASE_CAT_IDLE = SPR_BASE_BIN_TOP + 1,
+  SPR_BASE_CAT_WALK = SPR_BASE_CAT_IDLE + 8,
+  SPR_BASE_CAT_UP = SPR_BASE_CAT_WALK + 4,
+  SPR_BASE_CAT_HOLD = SPR_BASE_CAT_UP + 1,
+  SPR_BASE_CAT_DOWN = SPR_BASE_CAT_HOLD + 1,
+  SPR_BASE_CAT_1 = SPR_BASE_CAT_DOWN + 1,
+  SPR_BASE_CAT_POUNCE = SPR_BASE_CAT_1 + 1,
+  SPR_BASE_CAT_POUNCE_DOWN = SPR_BASE_CAT_POUNCE + 1,
+  SPR_BASE_DOG = SPR_BASE_CAT_POUNCE_DOWN + 2,
+  SPR_BASE_FIGHT = SPR_BASE_DOG + 2,
+  SPR_BASE_LAUNDRY = SPR_BASE_FIGHT + 3,
+  SPR_COUNT = SPR_BASE_LAUNDRY + 4
 };
 
-static int s_animCount = 0;
+const SheetSection SHEET_SECTIONS[] = {
+    {"NUM", SPR_BASE_NUM, SPR_BASE_MOUSE_IDLE - SPR_BASE_NUM},
+    {"MOUSE_IDLE", SPR_BASE_MOUSE_IDLE,
+     SPR_BASE_MOUSE_RUN - SPR_BASE_MOUSE_IDLE},
+    {"MOUSE_RUN", SPR_BASE_MOUSE_RUN, SPR_BASE_FOOD - SPR_BASE_MOUSE_RUN},
+    {"FOOD", SPR_BASE_FOOD, SPR_BASE_WINDOW - SPR_BASE_FOOD},
+    {"WINDOW", SPR_BASE_WINDOW, SPR_BASE_SQUEEK - SPR_BASE_WINDOW},
+    {"SQUEEK", SPR_BASE_SQUEEK, SPR_BASE_BIN_MID - SPR_BASE_SQUEEK},
+    {"BIN_MID", SPR_BASE_BIN_MID, SPR_BASE_BIN_TOP - SPR_BASE_BIN_MID},
+    {"BIN_TOP", SPR_BASE_BIN_TOP, SPR_BASE_CAT_IDLE - SPR_BASE_BIN_TOP},
+    {"CAT_IDLE", SPR_BASE_CAT_IDLE, SPR_BASE_CAT_WALK - SPR_BASE_CAT_IDLE},
+    {"CAT_WALK", SPR_BASE_CAT_WALK, SPR_BASE_CAT_UP - SPR_BASE_CAT_WALK},
+    {"CAT_UP", SPR_BASE_CAT_UP, SPR_BASE_CAT_HOLD - SPR_BASE_CAT_UP},
+    {"CAT_HOLD", SPR_BASE_CAT_HOLD, SPR_BASE_CAT_DOWN - SPR_BASE_CAT_HOLD},
+    {"CAT_DOWN", SPR_BASE_CAT_DOWN, SPR_BASE_CAT_1 - SPR_BASE_CAT_DOWN},
+    {"CAT_1", SPR_BASE_CAT_1, SPR_BASE_CAT_POUNCE - SPR_BASE_CAT_1},
+    {"CAT_POUNCE", SPR_BASE_CAT_POUNCE,
+     SPR_BASE_CAT_POUNCE_DOWN - SPR_BASE_CAT_POUNCE},
+    {"CAT_POUNCE_DOWN", SPR_BASE_CAT_POUNCE_DOWN,
+     SPR_BASE_DOG - SPR_BASE_CAT_POUNCE_DOWN},
+    {"DOG", SPR_BASE_DOG, SPR_BASE_FIGHT - SPR_BASE_DOG},
+    {"FIGHT", SPR_BASE_FIGHT, SPR_BASE_LAUNDRY - SPR_BASE_FIGHT},
+    {"LAUNDRY", SPR_BASE_LAUNDRY, SPR_COUNT - SPR_BASE_LAUNDRY}};
+const int NUM_SHEET_SECTIONS = sizeof(SHEET_SECTIONS) / sizeof(SheetSection);
+
+const int SPR_NUM[] = {SPR_BASE_NUM, SPR_BASE_NUM + 1, SPR_BASE_NUM + 2,
+                       SPR_BASE_NUM + 3, SPR_BASE_NUM + 4, SPR_BASE_NUM + 5,
+                       SPR_BASE_NUM + 6, SPR_BASE_NUM + 7, SPR_BASE_NUM + 8,
+                       SPR_BASE_NUM + 9, SPR_BASE_NUM + 10};
+const int SPR_MOUSE_IDLE[] = {SPR_BASE_MOUSE_IDLE};
+const int SPR_MOUSE_RUN[] = {SPR_BASE_MOUSE_RUN, SPR_BASE_MOUSE_RUN + 1};
+const int SPR_FOOD[] = {SPR_BASE_FOOD, SPR_BASE_FOOD + 1};
+const int SPR_WINDOW_CAT[] = {SPR_BASE_WINDOW, SPR_BASE_WINDOW + 2,
+                              SPR_BASE_WINDOW + 4, SPR_BASE_WINDOW + 6,
+                              SPR_BASE_WINDOW + 8, SPR_BASE_WINDOW + 10};
+const int SPR_WINDOW_EMPTY[] = {SPR_BASE_WINDOW + 1, SPR_BASE_WINDOW + 3,
+                                SPR_BASE_WINDOW + 5, SPR_BASE_WINDOW + 7,
+                                SPR_BASE_WINDOW + 9, SPR_BASE_WINDOW + 11};
+const int SPR_SQUEEK[] = {SPR_BASE_SQUEEK};
+const int SPR_BIN_MID[] = {SPR_BASE_BIN_MID};
+const int SPR_BIN_TOP[] = {SPR_BASE_BIN_TOP};
+const int SPR_CAT_IDLE[] = {SPR_BASE_CAT_IDLE, SPR_BASE_CAT_IDLE + 1,
+                            SPR_BASE_CAT_IDLE + 2, SPR_BASE_CAT_IDLE + 3,
+                            SPR_BASE_CAT_IDLE + 4, SPR_BASE_CAT_IDLE + 5,
+                            SPR_BASE_CAT_IDLE + 6, SPR_BASE_CAT_IDLE + 7};
+const int SPR_CAT_WALK[] = {SPR_BASE_CAT_WALK, SPR_BASE_CAT_WALK + 1,
+                            SPR_BASE_CAT_WALK + 2, SPR_BASE_CAT_WALK + 3};
+const int SPR_CAT_UP[] = {SPR_BASE_CAT_UP};
+const int SPR_CAT_HOLD[] = {SPR_BASE_CAT_HOLD};
+const int SPR_CAT_DOWN[] = {SPR_BASE_CAT_DOWN};
+const int SPR_CAT_1[] = {SPR_BASE_CAT_1};
+const int SPR_CAT_POUNCE[] = {SPR_BASE_CAT_POUNCE};
+const int SPR_CAT_POUNCE_DOWN[] = {SPR_BASE_CAT_POUNCE_DOWN,
+                                   SPR_BASE_CAT_POUNCE_DOWN + 1};
+const int SPR_DOG[] = {SPR_BASE_DOG, SPR_BASE_DOG + 1};
+const int SPR_FIGHT[] = {SPR_BASE_FIGHT, SPR_BASE_FIGHT + 1,
+                         SPR_BASE_FIGHT + 2};
+const int SPR_LAUNDRY[] = {SPR_BASE_LAUNDRY, SPR_BASE_LAUNDRY + 1,
+                           SPR_BASE_LAUNDRY + 2, SPR_BASE_LAUNDRY + 3};
 
 /////// FUNCTIONS - RECT / PT
 
@@ -162,7 +150,7 @@ Rect operator|(const Rect& a, const Rect& b) {
 
 int PixData::GetI(const Pt& p) const {
   SDL_assert(in(size, p));
-  return (p.x - size.x) + (p.y - size.y) * size.w;
+  return LocalI(p.x - size.x, p.y - size.y);
 }
 
 /////// MACRO
@@ -177,32 +165,19 @@ void SetupBackground(BackgroundData& bgData, const char* filename) {
 
   /**/
   bgData.size = {0, 0, bgSurf->w, bgSurf->h};
-  bgData.pixs = new uint8_t[bgSurf->w * bgSurf->h];
-  memcpy(bgData.pixs, bgSurf->pixels, bgSurf->w * bgSurf->h);
+  uint8_t* pixs = new uint8_t[bgSurf->w * bgSurf->h];
+  memcpy(pixs, bgSurf->pixels, bgSurf->w * bgSurf->h);
+  bgData.pixs = pixs;
   SDL_FreeSurface(bgSurf);
 }
 
-void SetupSprites(SpriteData& sprData, const char* filename) {
-  SDL_Surface* sprSurf = SDL_LoadBMP(filename);
-  if (sprSurf == 0) {
-    SDL_Log(SDL_GetBasePath());
-    SDL_Log(SDL_GetError());
-    return;
-  }
-
-  SDL_Log("Bytes %d, %d", sprSurf->format->BitsPerPixel,
-          sprSurf->format->format);
-
+void SliceSprites(SpriteData& sprData, const uint8_t* pixs, int width,
+                  int height) {
   ListOfPt corners;
-  int numSpritesTotal = 0;
 
-  SDL_Rect pxSz = sprSurf->clip_rect;
-  uint8_t* pixs = (uint8_t*)sprSurf->pixels;
+  SDL_Rect pxSz = {0, 0, width, height};
   uint8_t framePix = pixs[0];
 
-  // Fuck it Flip the mofo
-  uint8_t* tempLine = new uint8_t[pxSz.w];
-
   for (int y = 0; y < pxSz.h; ++y) {
     for (int x = 0; x < pxSz.w; ++x) {
       if ((pixs[x + y * pxSz.w] == framePix) &&
@@ -263,7 +238,6 @@ void SetupSprites(SpriteData& sprData, const char* filename) {
             r.y = currRect.y;
             r.h = currRect.h;
             sprData.sprRect.push_back(r);
-            ++numSpritesTotal;
             ++numSpr;
           }
 
@@ -279,137 +253,445 @@ void SetupSprites(SpriteData& sprData, const char* filename) {
   }
 
   /**/
-  sprData.sprPitch = sprSurf->w;
-  sprData.pixs = new uint8_t[sprSurf->w * sprSurf->h];
-  memcpy(sprData.pixs, sprSurf->pixels, sprSurf->w * sprSurf->h);
+  sprData.sprPitch = width;
+  uint8_t* sheetPixs = new uint8_t[width * height];
+  memcpy(sheetPixs, pixs, width * height);
+  sprData.pixs = sheetPixs;
+}
+
+void SetupSprites(SpriteData& sprData, const char* filename) {
+  SDL_Surface* sprSurf = SDL_LoadBMP(filename);
+  if (sprSurf == 0) {
+    SDL_Log(SDL_GetBasePath());
+    SDL_Log(SDL_GetError());
+    return;
+  }
+
+  SDL_Log("Bytes %d, %d", sprSurf->format->BitsPerPixel,
+          sprSurf->format->format);
+
+  SliceSprites(sprData, (const uint8_t*)sprSurf->pixels, sprSurf->w,
+               sprSurf->h);
   SDL_FreeSurface(sprSurf);
 
-  SDL_Log("Setup Done found %d sprites in %s", numSpritesTotal, filename);
+  SDL_Log("Setup Done found %d sprites in %s", (int)sprData.sprRect.size(),
+          filename);
+}
+
+int GenLaundryFront(LaundryLineData& line, const GameAssets* pAssets,
+                    std::mt19937& rng) {
+  int laundryC = rng() % 4;
+  int step = pAssets->laundryWidth[laundryC] + rng() % 20;
+  LaundryList& laundry = line.MutableLaundry();
+  laundry.insert(laundry.begin(), LaundryData{step, laundryC});
+
+  return step;
+}
+
+int GenLaundry(LaundryLineData& line, const GameAssets* pAssets,
+               std::mt19937& rng) {
+  int laundryC = rng() % 4;
+  int step = pAssets->laundryWidth[laundryC] + rng() % 20;
+  line.MutableLaundry().push_back(LaundryData{step, laundryC});
+
+  return step;
+}
+
+/////// LEVEL STREAMING
+// The alley is LEVEL_CHUNKS chunks wide, only numChunks around the camera
+// exist. Each tick moves the resident span by at most one chunk, so the
+// work per tick is bounded by one chunk build however fast the cat runs.
+
+int LaundryLineEnd(const LaundryLineData& line) {
+  const LaundryList& laundry = line.Laundry();
+  int x = line.offset;
+  for (size_t c = 0; c < laundry.size(); ++c) x += laundry[c].xStep;
+  return x;
+}
+
+// Drop laundry that is wholly outside [left, right), only unshares the
+// line if something actually goes
+void TrimLaundry(LaundryLineData& l, int left, int right) {
+  const LaundryList& laundry = l.Laundry();
+  size_t first = 0;
+  int offset = l.offset;
+  while ((first < laundry.size()) && (offset + laundry[first].xStep < left)) {
+    offset += laundry[first].xStep;
+    ++first;
+  }
+
+  size_t last = first;
+  int x = offset;
+  while ((x < right) && (last < laundry.size())) {
+    x += laundry[last].xStep;
+    ++last;
+  }
+
+  if ((first == 0) && (last == laundry.size())) return;
+
+  LaundryList& mutableLaundry = l.MutableLaundry();
+  mutableLaundry.erase(mutableLaundry.begin() + last, mutableLaundry.end());
+  mutableLaundry.erase(mutableLaundry.begin(), mutableLaundry.begin() + first);
+  l.offset = offset;
 }
 
-int SetupSpriteArray(int* arr, size_t numElem) {
-  int maxNum = 0;
-  int c = 0;
-  for (size_t i = 0; i < numElem; i++) {
-    c = arr[i];
-    if (maxNum < c) maxNum = c;
-    arr[i] = c + SPR_COUNT;
+// Bins, windows and the laundry hanging over it, all from seed and index
+void BuildChunk(GameStateData& gameState, int index, bool isLeftEdge) {
+  LevelChunk& chunk = gameState.chunks[index % MAX_RESIDENT_CHUNKS];
+  std::mt19937 rng(gameState.seed ^ ((uint32_t)index * 0x9E3779B9u));
+  int left = index * CHUNK_WIDTH;
+  int right = left + CHUNK_WIDTH;
+
+  chunk.index = index;
+  chunk.numBins = 0;
+  int x = left + 8 + rng() % 24;
+  while ((chunk.numBins < MAX_BINS_PER_CHUNK) && (x + BIN_WIDTH <= right)) {
+    int binHeight = 3 + rng() % 2;
+    chunk.bins[chunk.numBins++] =
+        Rect{x, (FLOOR_HEIGHT + 5), BIN_WIDTH, binHeight * 8 + 2};
+    x += BIN_WIDTH + 8 + rng() % 64;
   }
 
-  return maxNum + 1;
+  // At least one window per column
+  for (int w = 0; w < WINDOWS_PER_CHUNK; ++w) {
+    chunk.windowRows[w] = 1 + rng() % ((1 << NUM_LAUNDRY_LINES) - 1);
+  }
+
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    LaundryLineData& line = gameState.lines[y];
+    if (isLeftEdge) {
+      while (line.offset > left)
+        line.offset -= GenLaundryFront(line, gameState.assets, rng);
+    } else {
+      int end = LaundryLineEnd(line);
+      while (end < right) end += GenLaundry(line, gameState.assets, rng);
+    }
+  }
 }
 
-void SetupMySheet() {
-  SPR_COUNT += SetupSpriteArray(SPR_NUM, sizeof(SPR_NUM) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_MOUSE_IDLE, sizeof(SPR_MOUSE_IDLE) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_MOUSE_RUN, sizeof(SPR_MOUSE_RUN) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_FOOD, sizeof(SPR_FOOD) / sizeof(int));
+void StreamChunks(GameStateData& gameState) {
+  int center = (gameState.scrollPoint.x + gameState.screen_width / 2) /
+               CHUNK_WIDTH;
+  int wantFirst = center - gameState.numChunks / 2;
+  wantFirst = std::max(0, std::min(wantFirst, LEVEL_CHUNKS - gameState.numChunks));
 
-  SetupSpriteArray(SPR_WINDOW_CAT, sizeof(SPR_WINDOW_CAT) / sizeof(int));
-  SetupSpriteArray(SPR_WINDOW_EMPTY, sizeof(SPR_WINDOW_EMPTY) / sizeof(int));
-  SPR_COUNT += 12;
+  if (wantFirst == gameState.firstChunk) return;
 
-  SPR_COUNT += SetupSpriteArray(SPR_SQUEEK, sizeof(SPR_SQUEEK) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_BIN_MID, sizeof(SPR_BIN_MID) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_BIN_TOP, sizeof(SPR_BIN_TOP) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_CAT_IDLE, sizeof(SPR_CAT_IDLE) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_CAT_WALK, sizeof(SPR_CAT_WALK) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_CAT_UP, sizeof(SPR_CAT_UP) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_CAT_HOLD, sizeof(SPR_CAT_HOLD) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_CAT_DOWN, sizeof(SPR_CAT_DOWN) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_CAT_1, sizeof(SPR_CAT_1) / sizeof(int));
-  SPR_COUNT +=
-      SetupSpriteArray(SPR_CAT_POUNCE, sizeof(SPR_CAT_POUNCE) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_CAT_POUNCE_DOWN,
-                                sizeof(SPR_CAT_POUNCE_DOWN) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_DOG, sizeof(SPR_DOG) / sizeof(int));
-  SPR_COUNT += SetupSpriteArray(SPR_FIGHT, sizeof(SPR_FIGHT) / sizeof(int));
+  if (wantFirst > gameState.firstChunk) {
+    ++gameState.firstChunk;
+    BuildChunk(gameState, gameState.firstChunk + gameState.numChunks - 1,
+               false);
+  } else {
+    --gameState.firstChunk;
+    BuildChunk(gameState, gameState.firstChunk, true);
+  }
 
-  SPR_COUNT += SetupSpriteArray(SPR_LAUNDRY, sizeof(SPR_LAUNDRY) / sizeof(int));
+  int left = gameState.firstChunk * CHUNK_WIDTH;
+  int right = left + gameState.numChunks * CHUNK_WIDTH;
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    TrimLaundry(gameState.lines[y], left, right);
+  }
+}
 
-  SDL_Log("Setup %d sprites", SPR_COUNT);
+Rect WindowRect(const GameStateData& gameState, int window) {
+  const Rect& src = gameState.assets->sprites.sprRect[SPR_WINDOW_EMPTY[0]];
+  int column = window / NUM_LAUNDRY_LINES;
+  int line = window % NUM_LAUNDRY_LINES;
+  return Rect{20 + 80 * column, gameState.lines[line].lineHeight - 26, src.w,
+              src.h};
 }
 
-int GenLaundryFront(LaundryLineData& line, GameStateData& gameState) {
-  int laundryC = gameState.randGen() % 4;
-  int step = LAUNDRY_WIDTH[laundryC] + gameState.randGen() % 20;
-  line.laundry.insert(line.laundry.begin(), LaundryData{step, laundryC});
+// Any window in a resident chunk
+int PickActiveWindow(GameStateData& gameState) {
+  int numWindows = 0;
+  for (int i = 0; i < gameState.numChunks; ++i) {
+    const LevelChunk& chunk = gameState.Chunk(i);
+    for (int w = 0; w < WINDOWS_PER_CHUNK; ++w) {
+      for (int y = 0; y < NUM_LAUNDRY_LINES; ++y)
+        numWindows += (chunk.windowRows[w] >> y) & 1;
+    }
+  }
 
-  return step;
+  int pick = gameState.randGen() % numWindows;
+  for (int i = 0; i < gameState.numChunks; ++i) {
+    const LevelChunk& chunk = gameState.Chunk(i);
+    for (int w = 0; w < WINDOWS_PER_CHUNK; ++w) {
+      for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+        if (((chunk.windowRows[w] >> y) & 1) && (pick-- == 0))
+          return (chunk.index * WINDOWS_PER_CHUNK + w) * NUM_LAUNDRY_LINES + y;
+      }
+    }
+  }
+  return 0;
 }
 
-int GenLaundry(LaundryLineData& line, GameStateData& gameState) {
-  int laundryC = gameState.randGen() % 4;
-  int step = LAUNDRY_WIDTH[laundryC] + gameState.randGen() % 20;
-  line.laundry.push_back(LaundryData{step, laundryC});
+bool GameFinishAssets(GameAssets* pAssets) {
+  if ((int)pAssets->sprites.sprRect.size() < SPR_COUNT) {
+    SDL_Log("Expected %d sprites found %d", SPR_COUNT,
+            (int)pAssets->sprites.sprRect.size());
+    return false;
+  }
 
-  return step;
+  for (int c = 0; c < 4; ++c) {
+    pAssets->laundryWidth[c] = pAssets->sprites.sprRect[SPR_LAUNDRY[c]].w;
+  }
+
+  // An atlas brings its own
+  if (pAssets->sprites.maskFirst.size() != pAssets->sprites.sprRect.size())
+    BuildSpriteMasks(pAssets->sprites);
+  return true;
 }
 
-GameStateData* GameSetup(uint16_t width, uint16_t height) {
-  GameStateData* pGameState = new GameStateData();
-  pGameState->screen_width = width;
-  pGameState->screen_height = height;
+GameAssets* GameLoadAssets(const char* spriteFile, const char* floorFile) {
+  GameAssets* pAssets = new GameAssets();
+  SetupSprites(pAssets->sprites, spriteFile);
+  SetupBackground(pAssets->floor, floorFile);
+  if (!GameFinishAssets(pAssets)) {
+    GameAssetsDestroy(pAssets);
+    return nullptr;
+  }
+  return pAssets;
+}
 
-  pGameState->level_bounds = Rect{0, 0, 320, 240};
+struct AssetLoadJob {
+  GameAssets* pAssets;
+  const char* spriteFile;
+  const char* floorFile;
+};
 
-  pGameState->scrollPoint = {0, 0};
+static void LoadSpritesJob(void* pData) {
+  AssetLoadJob* pLoad = (AssetLoadJob*)pData;
+  SetupSprites(pLoad->pAssets->sprites, pLoad->spriteFile);
+}
 
-  SetupSprites(pGameState->sprites, "sprites.bmp");
-  SetupBackground(pGameState->floor, "floor.bmp");
-  SetupMySheet();
+static void LoadFloorJob(void* pData) {
+  AssetLoadJob* pLoad = (AssetLoadJob*)pData;
+  SetupBackground(pLoad->pAssets->floor, pLoad->floorFile);
+}
+
+// Sprite sheet and floor decode side by side
+GameAssets* GameLoadAssetsWithJobs(JobSystem* pJobs, const char* spriteFile,
+                                   const char* floorFile) {
+  AssetLoadJob load = {new GameAssets(), spriteFile, floorFile};
+  Job* pDone = JobCreate(pJobs, nullptr, nullptr);
+  Job* pSprites = JobCreate(pJobs, LoadSpritesJob, &load);
+  Job* pFloor = JobCreate(pJobs, LoadFloorJob, &load);
+  JobAddDependency(pDone, pSprites);
+  JobAddDependency(pDone, pFloor);
+  JobSubmit(pJobs, pDone);
+  JobSubmit(pJobs, pSprites);
+  JobSubmit(pJobs, pFloor);
+  JobWait(pJobs, pDone);
+
+  if (!GameFinishAssets(load.pAssets)) {
+    GameAssetsDestroy(load.pAssets);
+    return nullptr;
+  }
+  return load.pAssets;
+}
+
+void GameAssetsDestroy(GameAssets* pAssets) {
+  if (pAssets == nullptr) return;
+  delete[] pAssets->sprites.pixs;
+  delete[] pAssets->floor.pixs;
+  delete pAssets;
+}
+
+void GameInit(GameStateData& gameState, const GameAssets* pAssets,
+              uint16_t width, uint16_t height, uint32_t seed) {
+  gameState.assets = pAssets;
+  gameState.screen_width = width;
+  gameState.screen_height = height;
+
+  gameState.level_bounds = Rect{0, 0, LEVEL_CHUNKS * CHUNK_WIDTH, 240};
+
+  gameState.scrollPoint = {0, 0};
+  gameState.animCount = 0;
 
   // Setup Random
-  // pGameState->randGen.seed(std::chrono::high_resolution_clock::now());
+  gameState.seed = seed;
+  gameState.randGen.seed(seed);
 
   // Setup Cat
-  pGameState->cat.pos = {30, FLOOR_HEIGHT};
-  pGameState->cat.state = CatData::Idle;
-  pGameState->cat.isGrounded = true;
-  pGameState->cat.upFrames = 0;
-  pGameState->cat.dontLandForFrames = 0;
-  pGameState->cat.isRunning = false;
+  gameState.cat.pos = {30, FLOOR_HEIGHT};
+  gameState.cat.holdPos = {0, 0};
+  gameState.cat.state = CatData::Idle;
+  gameState.cat.isGrounded = true;
+  gameState.cat.upFrames = 0;
+  gameState.cat.noLandTimer = TIMER_NONE;
+  gameState.cat.isRunning = false;
+  gameState.cat.framesRunning = 0;
+  gameState.cat2 = gameState.cat;
+  gameState.numCats = 1;
+  gameState.windowsWon[0] = gameState.windowsWon[1] = 0;
+
+  // Setup Timers
+  TimerInit(gameState.timers);
 
   // Setup Lines
-  pGameState->lines = new LaundryLineData[4];
-  pGameState->movingLine = 0;
-  pGameState->movingLineFrames = 0;
+  gameState.movingLine = 0;
+  gameState.isLineMoving = false;
+  gameState.lineTimer =
+      TimerAdd(gameState.timers, LINE_REST_FRAMES, EVT_LINE_START, 0);
+
+  for (int i = 0; i < NUM_LAUNDRY_LINES; ++i) {
+    gameState.lines[i].lineHeight = (FENCE_HEIGHT + 31 + 32 * i);
+    gameState.lines[i].scrollDir = 0;
+    gameState.lines[i].MutableLaundry().clear();
+    gameState.lines[i].offset = gameState.randGen() % 20;
+  }
 
-  for (int c = 0; c < 4; ++c) {
-    LAUNDRY_WIDTH[c] = pGameState->sprites.sprRect[SPR_LAUNDRY[c]].w;
+  // Setup Chunks, enough to cover the screen plus a chunk either side
+  gameState.firstChunk = 0;
+  gameState.numChunks =
+      std::min(MAX_RESIDENT_CHUNKS, (width + CHUNK_WIDTH - 1) / CHUNK_WIDTH + 2);
+  for (int i = 0; i < gameState.numChunks; ++i) {
+    BuildChunk(gameState, i, false);
   }
 
-  for (int i = 0; i < 4; ++i) {
-    pGameState->lines[i].lineHeight = (FENCE_HEIGHT + 31 + 32 * i);
+  // Setup Windows
+  gameState.isMeowUnlocked = false;
+  gameState.activeWindow = PickActiveWindow(gameState);
+  gameState.windowOpenTick = gameState.timers.now;
+  gameState.windowTimer =
+      TimerAdd(gameState.timers, WINDOW_OPEN_TIME, EVT_WINDOW_CLOSE, 0);
+
+  // Setup Effects
+  ParticlesClear(gameState.pParticles);
+  gameState.sounds = 0;
+}
+
+GameStateData* GameSetupWithAssets(const GameAssets* pAssets, uint16_t width,
+                                   uint16_t height, uint32_t seed) {
+  GameStateData* pGameState = new GameStateData();
+  pGameState->pParticles = ParticlesCreate(seed);
+  GameInit(*pGameState, pAssets, width, height, seed);
+  return pGameState;
+}
+
+GameStateData* GameSetup(uint16_t width, uint16_t height, uint32_t seed) {
+  GameAssets* pAssets = GameLoadAssets("sprites.bmp", "floor.bmp");
+  if (pAssets == nullptr) return nullptr;
+  GameStateData* pGameState =
+      GameSetupWithAssets(pAssets, width, height, seed);
+  pGameState->pOwnedAssets = pAssets;
+  return pGameState;
+}
+
+uint32_t GameGetSeed(GameStateData* pGameState) { return pGameState->seed; }
+
+void GameSetAssets(GameStateData* pGameState, const GameAssets* pAssets) {
+  pGameState->assets = pAssets;
+}
+
+uint16_t GamePaletteColour(int i) { return GBAColours[i & 3]; }
+
+int GameButtonBits(const ButState& buttons) {
+  return (buttons.up ? 1 : 0) | (buttons.down ? 2 : 0) |
+         (buttons.left ? 4 : 0) | (buttons.right ? 8 : 0);
+}
 
-    pGameState->lines[i].offset = pGameState->randGen() % 20;
-    int x = pGameState->lines[i].offset;
+ButState GameHeldButtons(int held, int wasHeld) {
+  const int v[4] = {1, 2, 4, 8};
+  int state[4];
+  for (int i = 0; i < 4; ++i)
+    state[i] = (held & v[i]) ? ((wasHeld & v[i]) ? 1 : 3) : 0;
+  return ButState{state[0], state[1], state[2], state[3]};
+}
 
-    while (x < pGameState->level_bounds.w) {
-      x += GenLaundry(pGameState->lines[i], *pGameState);
+void GamePaletteIndexTable(uint8_t* toIndex) {
+  for (int c = 0; c < 4096; ++c) {
+    int bestDist = 1 << 30;
+    for (int i = 0; i < 4; ++i) {
+      uint16_t p = GBAColours[i];
+      int dr = ((c >> 8) & 0xF) - ((p >> 8) & 0xF);
+      int dg = ((c >> 4) & 0xF) - ((p >> 4) & 0xF);
+      int db = (c & 0xF) - (p & 0xF);
+      int dist = dr * dr + dg * dg + db * db;
+      if (dist < bestDist) {
+        bestDist = dist;
+        toIndex[c] = (uint8_t)i;
+      }
     }
   }
+}
 
-  // Setup Windows
-  pGameState->isMeowUnlocked = false;
-  pGameState->activeWindow = pGameState->randGen() % (4 * 4);
-  pGameState->windowOpenTime = 0;
+void GameAddSecondCat(GameStateData* pGameState) {
+  pGameState->cat2 = pGameState->cat;
+  pGameState->cat2.pos.x += 2 * CAT_HEIGHT;
+  pGameState->cat2.noLandTimer = TIMER_NONE;
+  pGameState->numCats = 2;
+}
 
-  // Setup Bins
-  int binPos[6] = {27, 63, 107, 155, 243, 283};
-  int binHeight[6] = {3, 4, 3, 3, 3, 4};
-  for (int i = 0; i < 6; ++i) {
-    pGameState->bins.push_back(
-        Rect{binPos[i], (FLOOR_HEIGHT + 5), 27, binHeight[i] * 8 + 2});
-  }
+int GameWindowsWon(GameStateData* pGameState, int cat) {
+  return pGameState->windowsWon[cat & 1];
+}
 
-  return pGameState;
+uint32_t GameTakeSounds(GameStateData* pGameState) {
+  uint32_t sounds = pGameState->sounds;
+  pGameState->sounds = 0;
+  return sounds;
+}
+
+GameStateData* GameFork(GameStateData* pGameState) {
+  GameStateData* pFork = new GameStateData();
+  GameForkInto(pFork, pGameState);
+  return pFork;
+}
+
+void GameForkInto(GameStateData* pDst, GameStateData* pSrc) {
+  if (pDst == pSrc) return;
+
+  ParticleSystem* pParticles = pDst->pParticles;
+  GameAssets* pOwnedAssets = pDst->pOwnedAssets;
+  *pDst = *pSrc;
+  pDst->pParticles = pParticles;
+  pDst->pOwnedAssets = pOwnedAssets;
+  pDst->sounds = 0;
+}
+
+void GameDestroy(GameStateData* pGameState) {
+  if (pGameState == nullptr) return;
+  ParticlesDestroy(pGameState->pParticles);
+  GameAssetsDestroy(pGameState->pOwnedAssets);
+  delete pGameState;
+}
+
+/////// EFFECTS
+
+// Dust out either side of the paws
+void EmitLandDust(ParticleSystem* pParticles, const CatData& cat) {
+  ParticleBurst dust = {(float)cat.pos.x, (float)cat.pos.y, 0.0f, 0.8f,
+                        1.2f, 0.4f, 10, GBAColours[2]};
+  ParticlesEmit(pParticles, dust, 12);
+}
+
+// Streak left behind the cat as it leaps
+void EmitPounceTrail(ParticleSystem* pParticles, const CatData& cat, int dir) {
+  ParticleBurst trail = {(float)cat.pos.x, (float)(cat.pos.y + CAT_HEIGHT / 2),
+                         -1.5f * dir, 0.3f, 0.5f, 0.5f, 14, GBAColours[3]};
+  ParticlesEmit(pParticles, trail, 16);
+}
+
+// Fight cloud sprite burst into its pixels, centre is in world space
+void EmitFight(ParticleSystem* pParticles, const SpriteData& sprites,
+               Pt centre, int frame) {
+  if (pParticles == nullptr) return;
+
+  const Rect& spr = sprites.sprRect[SPR_FIGHT[frame]];
+  for (int y = 0; y < spr.h; ++y) {
+    for (int x = 0; x < spr.w; ++x) {
+      int col = sprites.pixs[(spr.x + x) + (spr.y + y) * sprites.sprPitch];
+      if ((col < 1) || (col > 4)) continue;
+
+      float dx = (float)(x - spr.w / 2);
+      float dy = (float)(spr.h / 2 - y);
+      ParticleBurst bit = {centre.x + dx, centre.y + dy, dx * 0.15f,
+                           dy * 0.15f + 1.0f, 0.3f, 0.3f, 30,
+                           GBAColours[col - 1]};
+      ParticlesEmit(pParticles, bit, 1);
+    }
+  }
 }
 
 void CatSetState(CatData& cat, CatData::CState newState) {
@@ -422,10 +704,10 @@ void CatSetState(CatData& cat, CatData::CState newState) {
                                     (newState == CatData::PounceRight));
 }
 
-void GroundCat(CatData& cat) {
+void GroundCat(CatData& cat, ParticleSystem* pParticles) {
+  EmitLandDust(pParticles, cat);
   cat.isGrounded = true;
   cat.upFrames = 0;
-  cat.dontLandForFrames = 0;
   if (cat.state == CatData::PounceRight)
     CatSetState(cat, CatData::Right);
   else if (cat.state == CatData::PounceLeft)
@@ -444,14 +726,17 @@ void CatCheckForLanding(const GameStateData& gameDat, CatData& cat,
     }
 
     // Check Bins
-    for (size_t i = 0; i < gameDat.bins.size(); ++i) {
-      Rect binRect = gameDat.bins[i];
-      if (((cat.pos.x + 3) >= binRect.x) &&
-          ((cat.pos.x - 3) < (binRect.x + binRect.w))) {
-        int topY = binRect.y + binRect.h + 6;
-
-        if (cat.pos.y <= topY) {
-          return;
+    for (int i = 0; i < gameDat.numChunks; ++i) {
+      const LevelChunk& chunk = gameDat.Chunk(i);
+      for (int b = 0; b < chunk.numBins; ++b) {
+        Rect binRect = chunk.bins[b];
+        if (((cat.pos.x + 3) >= binRect.x) &&
+            ((cat.pos.x - 3) < (binRect.x + binRect.w))) {
+          int topY = binRect.y + binRect.h + 6;
+
+          if (cat.pos.y <= topY) {
+            return;
+          }
         }
       }
     }
@@ -464,7 +749,7 @@ void CatCheckForLanding(const GameStateData& gameDat, CatData& cat,
     // Floor
     if (cat.pos.y <= FLOOR_HEIGHT) {
       cat.pos.y = FLOOR_HEIGHT;
-      GroundCat(cat);
+      GroundCat(cat, gameDat.pParticles);
       return;
     } else if (cat.pos.y > FENCE_HEIGHT) {
       // Clothes
@@ -473,11 +758,12 @@ void CatCheckForLanding(const GameStateData& gameDat, CatData& cat,
             (cat.pos.y >= (gameDat.lines[y].lineHeight - 16))) {
           int x = gameDat.lines[y].offset;
 
-          int maxL = gameDat.lines[y].laundry.size();
+          const LaundryList& laundry = gameDat.lines[y].Laundry();
+          int maxL = laundry.size();
           for (int c = 0; c < maxL; ++c) {
-            auto l = gameDat.lines[y].laundry[c];
+            auto l = laundry[c];
             if ((cat.pos.x + 2 > x) &&
-                (cat.pos.x - 2 < (x + LAUNDRY_WIDTH[l.laundryType]))) {
+                (cat.pos.x - 2 < (x + gameDat.assets->laundryWidth[l.laundryType]))) {
               cat.holdPos = Pt{c, y};
               cat.pos.y = gameDat.lines[y].lineHeight - 13;
               cat.state = CatData::Hold;
@@ -494,28 +780,39 @@ void CatCheckForLanding(const GameStateData& gameDat, CatData& cat,
     // Fence
     else if ((prevPos.y >= FENCE_HEIGHT) && (cat.pos.y <= FENCE_HEIGHT)) {
       cat.pos.y = FENCE_HEIGHT;
-      GroundCat(cat);
+      GroundCat(cat, gameDat.pParticles);
       return;
     }
     // Check Bins
 
-    for (size_t i = 0; i < gameDat.bins.size(); ++i) {
-      Rect binRect = gameDat.bins[i];
-      if (((cat.pos.x + 3) >= binRect.x) &&
-          ((cat.pos.x - 3) < (binRect.x + binRect.w))) {
-        int topY = binRect.y + binRect.h + 6;
-
-        if ((prevPos.y > topY) && (cat.pos.y <= topY)) {
-          cat.pos.y = topY;
-          GroundCat(cat);
-          return;
+    for (int i = 0; i < gameDat.numChunks; ++i) {
+      const LevelChunk& chunk = gameDat.Chunk(i);
+      for (int b = 0; b < chunk.numBins; ++b) {
+        Rect binRect = chunk.bins[b];
+        if (((cat.pos.x + 3) >= binRect.x) &&
+            ((cat.pos.x - 3) < (binRect.x + binRect.w))) {
+          int topY = binRect.y + binRect.h + 6;
+
+          if ((prevPos.y > topY) && (cat.pos.y <= topY)) {
+            cat.pos.y = topY;
+            GroundCat(cat, gameDat.pParticles);
+            return;
+          }
         }
       }
     }
   }
 }
 
-void TickCat(CatData& cat, ButState* buttons) {
+// Falls through whatever it stands on for a few frames
+void CatDropThrough(TimerWheel& timers, CatData& cat, int catIndex) {
+  TimerCancel(timers, cat.noLandTimer);
+  cat.noLandTimer =
+      TimerAdd(timers, DROP_THROUGH_FRAMES, EVT_CAT_CAN_LAND, catIndex);
+}
+
+void TickCat(TimerWheel& timers, CatData& cat, int catIndex,
+             ButState* buttons) {
   // Grounded and in Control
   if (cat.state == CatData::Hold) {
     //
@@ -536,7 +833,7 @@ void TickCat(CatData& cat, ButState* buttons) {
     } else if (buttons->down > 0) {
       cat.isGrounded = false;
       cat.upFrames = -1;
-      cat.dontLandForFrames = 3;
+      CatDropThrough(timers, cat, catIndex);
       if (buttons->left > 0)
         CatSetState(cat, CatData::DownLeft);
       else if (buttons->right > 0)
@@ -570,7 +867,7 @@ void TickCat(CatData& cat, ButState* buttons) {
     } else if (buttons->down > 0) {
       cat.isGrounded = false;
       cat.upFrames = -1;
-      cat.dontLandForFrames = 3;
+      CatDropThrough(timers, cat, catIndex);
 
       if (buttons->left > 0)
         CatSetState(cat, CatData::DownLeft);
@@ -654,128 +951,216 @@ void TickCat(CatData& cat, ButState* buttons) {
   }
 }
 
-void Tick(GameStateData* pGameData, ButState* buttons) {
-  Pt prevCatPos = pGameData->cat.pos;
-  TickCat(pGameData->cat, buttons);
+template <size_t N>
+int AnimFrame(const int (&frames)[N], int step) {
+  return frames[step % N];
+}
 
-  // Animate Windows
-  pGameData->windowOpenTime += 1;
-  if (pGameData->windowOpenTime >= WINDOW_OPEN_TIME) {
-    pGameData->windowOpenTime = 0;
-    pGameData->activeWindow = pGameData->randGen() % (4 * 4);
+// Sprite for the cat's state and animation step, left facing ones flipped
+int CatSprite(const CatData& cat, int animCount, bool& isFlipped) {
+  isFlipped =
+      (cat.state == CatData::Left) || (cat.state == CatData::PounceLeft);
+
+  switch (cat.state) {
+    case CatData::Idle:
+      return AnimFrame(SPR_CAT_IDLE, animCount / 10);
+    case CatData::Left:
+    case CatData::Right:
+      return AnimFrame(SPR_CAT_WALK, animCount / 7);
+    case CatData::Up:
+      return AnimFrame(SPR_CAT_UP, animCount / 10);
+    case CatData::PounceLeft:
+    case CatData::PounceRight:
+      return AnimFrame(SPR_CAT_POUNCE, animCount / 10);
+    case CatData::Down:
+      return AnimFrame(SPR_CAT_DOWN, animCount / 10);
+    case CatData::DownLeft:
+    case CatData::DownRight:
+      return AnimFrame(SPR_CAT_POUNCE_DOWN, animCount / 10);
+    case CatData::Hold:
+    default:
+      return AnimFrame(SPR_CAT_HOLD, animCount / 10);
   }
+}
 
-  // Move Laundry Line
-  pGameData->movingLineFrames -= 1;
-  if (pGameData->movingLineFrames > 0) {
-    LaundryLineData& l = pGameData->lines[pGameData->movingLine];
-    l.offset += l.scrollDir;
+// Landing and windows for one cat after the level has moved
+void TickCatCollisions(GameStateData* pGameData, int catIndex,
+                       const Pt& prevCatPos) {
+  CatData& cat = pGameData->Cat(catIndex);
+
+  // Force into Game Bounds
+  if (cat.pos.x < CAT_HEIGHT) {
+    cat.pos.x = CAT_HEIGHT;
+    cat.state = CatData::Down;
+  } else if (cat.pos.x > (pGameData->level_bounds.w - CAT_HEIGHT)) {
+    cat.pos.x = (pGameData->level_bounds.w - CAT_HEIGHT);
+    cat.state = CatData::Down;
+  }
 
-    if ((pGameData->cat.state == CatData::Hold) &&
-        (pGameData->movingLine == pGameData->cat.holdPos.y)) {
-      pGameData->cat.pos.x += l.scrollDir;
+  // Check Landing
+  if ((cat.upFrames <= 0) && (cat.state != CatData::Hold) &&
+      (cat.noLandTimer == TIMER_NONE)) {
+    bool wasFalling = !cat.isGrounded;
+    CatCheckForLanding(*pGameData, cat, prevCatPos);
+    if (wasFalling && cat.isGrounded)
+      pGameData->sounds |= 1 << SND_LAND;
+  }
+
+  // Jump into Window, unless the other cat just did
+  if (pGameData->windowOpenTick != pGameData->timers.now - WINDOW_OPEN_TIME) {
+	  // Flipped to screen y like the cat's below
+	  Rect windowRect = WindowRect(*pGameData, pGameData->activeWindow);
+	  windowRect.y = pGameData->screen_height - windowRect.y - windowRect.h;
+
+	  // The cat as drawn against the window, a pixel of each is a hit. The
+	  // frame Render shows is after this tick's ++animCount
+	  const SpriteData& sprites = pGameData->assets->sprites;
+	  bool isFlipped;
+	  int catSprite = CatSprite(cat, pGameData->animCount + 1, isFlipped);
+	  const Rect& catRectSrc = sprites.sprRect[catSprite];
+	  Rect catRect = Rect{ cat.pos.x - catRectSrc.w / 2,
+		  pGameData->screen_height - cat.pos.y - catRectSrc.h,
+		  catRectSrc.w, catRectSrc.h };
+
+	  if (MasksOverlap(SpriteMask(sprites, catSprite, isFlipped), catRect,
+	                   SpriteMask(sprites, SPR_WINDOW_EMPTY[0], false),
+	                   windowRect)) {
+		  // Jump into Window, scrap with whoever's in, shut it and move on
+		  EmitFight(pGameData->pParticles, pGameData->assets->sprites,
+		            Pt{windowRect.x + windowRect.w / 2,
+		               pGameData->screen_height - windowRect.y - windowRect.h / 2},
+		            pGameData->timers.now % 3);
+		  pGameData->sounds |= 1 << SND_FIGHT;
+		  ++pGameData->windowsWon[catIndex];
+		  pGameData->windowOpenTick = pGameData->timers.now - WINDOW_OPEN_TIME;
+		  TimerCancel(pGameData->timers, pGameData->windowTimer);
+		  pGameData->windowTimer =
+		      TimerAdd(pGameData->timers, 1, EVT_WINDOW_CLOSE, 0);
+	  }
+  }
+}
+
+// One tick with an input per cat, buttons[1] only read in two player games
+static void TickGame(GameStateData* pGameData, ButState* const* buttons) {
+  int numCats = pGameData->numCats;
+  Pt prevCatPos[2];
+  for (int i = 0; i < numCats; ++i) prevCatPos[i] = pGameData->Cat(i).pos;
+  TimerAdvance(pGameData->timers);
+
+  for (int i = 0; i < numCats; ++i) {
+    CatData& cat = pGameData->Cat(i);
+    CatData::CState prevCatState = cat.state;
+    bool wasGrounded = cat.isGrounded;
+    TickCat(pGameData->timers, cat, i, buttons[i]);
+
+    if (cat.state != prevCatState) {
+      if (cat.state == CatData::PounceLeft)
+        EmitPounceTrail(pGameData->pParticles, cat, -1);
+      else if (cat.state == CatData::PounceRight)
+        EmitPounceTrail(pGameData->pParticles, cat, 1);
     }
-  } else if (pGameData->movingLineFrames == 0) {
-    // Done Scrolling Clean up Laundry
-    LaundryLineData& l = pGameData->lines[pGameData->movingLine];
-    while (l.offset + l.laundry[0].xStep < 0) {
-      l.offset += l.laundry[0].xStep;
-      l.laundry.erase(l.laundry.begin());
+    if (wasGrounded && (cat.upFrames > 0)) {
+      bool isPounce = (cat.state == CatData::PounceLeft) ||
+                      (cat.state == CatData::PounceRight);
+      pGameData->sounds |= 1 << (isPounce ? SND_POUNCE : SND_JUMP);
     }
+  }
 
-    int x = l.offset;
-    auto lp = l.laundry.begin();
-    while ((x < pGameData->level_bounds.w) && (lp != l.laundry.end())) {
-      x += lp->xStep;
-      ++lp;
-    }
+  // Timers
+  int event, param;
+  while (TimerPopExpired(pGameData->timers, event, param)) {
+    switch (event) {
+      case EVT_WINDOW_CLOSE:
+        pGameData->windowOpenTick = pGameData->timers.now;
+        pGameData->activeWindow = PickActiveWindow(*pGameData);
+        pGameData->windowTimer = TimerAdd(pGameData->timers, WINDOW_OPEN_TIME,
+                                          EVT_WINDOW_CLOSE, 0);
+        break;
 
-    l.laundry.erase(lp, l.laundry.end());
-  } else if (pGameData->movingLineFrames < -20) {
-    // Pick Line
-    pGameData->movingLineFrames = 20;
-    pGameData->movingLine = pGameData->randGen() % 4;
-    LaundryLineData& l = pGameData->lines[pGameData->movingLine];
-    l.scrollDir = (pGameData->randGen() & 2) - 1;
+      case EVT_LINE_START: {
+        // Pick Line
+        pGameData->isLineMoving = true;
+        pGameData->movingLine = pGameData->randGen() % 4;
+        LaundryLineData& l = pGameData->lines[pGameData->movingLine];
+        l.scrollDir = (pGameData->randGen() & 2) - 1;
+
+        // Generate New Laundry
+        if (l.scrollDir > 0) {
+          int x = 0;
+          while (x < LINE_MOVE_FRAMES) {
+            x += GenLaundryFront(l, pGameData->assets, pGameData->randGen);
+          }
+          l.offset -= x;
+        } else {
+          int x = 0;
+          while (x < LINE_MOVE_FRAMES) {
+            x += GenLaundry(l, pGameData->assets, pGameData->randGen);
+          }
+        }
 
-    // Generate New Laundry
-    if (l.scrollDir > 0) {
-      int x = 0;
-      while (x < 20) {
-        x += GenLaundryFront(l, *pGameData);
+        pGameData->lineTimer = TimerAdd(pGameData->timers, LINE_MOVE_FRAMES,
+                                        EVT_LINE_STOP, 0);
+        break;
       }
-      l.offset -= x;
-    } else {
-      int x = 0;
-      while (x < 20) {
-        x += GenLaundry(l, *pGameData);
+
+      case EVT_LINE_STOP: {
+        // Done Scrolling Clean up Laundry
+        pGameData->isLineMoving = false;
+        int left = pGameData->firstChunk * CHUNK_WIDTH;
+        TrimLaundry(pGameData->lines[pGameData->movingLine], left,
+                    left + pGameData->numChunks * CHUNK_WIDTH);
+        pGameData->lineTimer = TimerAdd(pGameData->timers, LINE_REST_FRAMES,
+                                        EVT_LINE_START, 0);
+        break;
       }
-    }
 
-    // Move Cat
-    if ((pGameData->cat.state == CatData::Hold) &&
-        (pGameData->movingLine == pGameData->cat.holdPos.y)) {
-      pGameData->cat.pos.x += l.scrollDir;
+      case EVT_CAT_CAN_LAND:
+        pGameData->Cat(param).noLandTimer = TIMER_NONE;
+        break;
     }
   }
 
-  // Force into Game Bounds
-  if (pGameData->cat.pos.x < CAT_HEIGHT) {
-    pGameData->cat.pos.x = CAT_HEIGHT;
-    pGameData->cat.state = CatData::Down;
-  } else if (pGameData->cat.pos.x > (pGameData->level_bounds.w - CAT_HEIGHT)) {
-    pGameData->cat.pos.x = (pGameData->level_bounds.w - CAT_HEIGHT);
-    pGameData->cat.state = CatData::Down;
-  }
-
-  // Check Landing
-  if ((pGameData->cat.upFrames <= 0) &&
-      (pGameData->cat.state != CatData::Hold) &&
-      (pGameData->cat.dontLandForFrames <= 0)) {
-    CatCheckForLanding(*pGameData, pGameData->cat, prevCatPos);
-  }
+  // Move Laundry Line
+  if (pGameData->isLineMoving) {
+    LaundryLineData& l = pGameData->lines[pGameData->movingLine];
+    l.offset += l.scrollDir;
 
-  // Jump into Window
-  {
-	  const Rect& windowRectSrc = pGameData->sprites.sprRect[SPR_WINDOW_EMPTY[0]];
-	  int x = pGameData->activeWindow % 4;
-	  int y = pGameData->activeWindow / 4;
-
-	  Rect windowRect = Rect{
-		  20 + 80 * x,
-		  pGameData->screen_height - pGameData->lines[y].lineHeight + 26 - windowRectSrc.h,
-		  windowRectSrc.w, windowRectSrc.h };
-	  Rect catRect = Rect{ pGameData->cat.pos.x - CAT_HEIGHT / 2,
-		  pGameData->screen_height - pGameData->cat.pos.y - CAT_HEIGHT,
-		  CAT_HEIGHT, CAT_HEIGHT };
-
-	  Rect hitRect = catRect & windowRect;
-	  if ((hitRect.w > 1) && (hitRect.h > 1)) {
-		  // Jump into Window
-		  pGameData->windowOpenTime = WINDOW_OPEN_TIME;
-	  }
+    for (int i = 0; i < numCats; ++i) {
+      CatData& cat = pGameData->Cat(i);
+      if ((cat.state == CatData::Hold) &&
+          (pGameData->movingLine == cat.holdPos.y)) {
+        cat.pos.x += l.scrollDir;
+      }
+    }
   }
 
-  if (pGameData->cat.dontLandForFrames > 0)
-    pGameData->cat.dontLandForFrames -= 1;
+  for (int i = 0; i < numCats; ++i)
+    TickCatCollisions(pGameData, i, prevCatPos[i]);
 
-  // Scroll Screen
-  Pt catScreenPt = Pt{pGameData->cat.pos.x - pGameData->scrollPoint.x,
-                      pGameData->cat.pos.y + pGameData->scrollPoint.y};
+  // Scroll Screen, two cats share the camera between them
+  CatData focus = pGameData->cat;
+  if (numCats == 2) {
+    focus.pos.x = (pGameData->cat.pos.x + pGameData->cat2.pos.x) / 2;
+    focus.pos.y = (pGameData->cat.pos.y + pGameData->cat2.pos.y) / 2;
+    focus.state = CatData::Idle;
+    focus.framesRunning = 0;
+  }
+  Pt catScreenPt = Pt{focus.pos.x - pGameData->scrollPoint.x,
+                      focus.pos.y + pGameData->scrollPoint.y};
 
   // Core Bounds LEFT / RIGHT
   if ((catScreenPt.x < CAMERA_LEFT_BOUND) ||
-      ((pGameData->cat.state == CatData::Left) &&
-       ((catScreenPt.x - pGameData->cat.framesRunning) < CAMERA_LEFT_BOUND))) {
+      ((focus.state == CatData::Left) &&
+       ((catScreenPt.x - focus.framesRunning) < CAMERA_LEFT_BOUND))) {
     pGameData->scrollPoint.x -=
-        CAMERA_LEFT_BOUND - catScreenPt.x + pGameData->cat.framesRunning;
+        CAMERA_LEFT_BOUND - catScreenPt.x + focus.framesRunning;
   } else if (catScreenPt.x < CAMERA_LEFT_BOUND) {
     pGameData->scrollPoint.x -= CAMERA_LEFT_BOUND - catScreenPt.x;
-  } else if (((pGameData->cat.state == CatData::Right) &&
-              ((catScreenPt.x + pGameData->cat.framesRunning +
+  } else if (((focus.state == CatData::Right) &&
+              ((catScreenPt.x + focus.framesRunning +
                 CAMERA_RIGHT_BOUND) > pGameData->screen_width))) {
     pGameData->scrollPoint.x -= pGameData->screen_width - CAMERA_RIGHT_BOUND -
-                                catScreenPt.x - pGameData->cat.framesRunning;
+                                catScreenPt.x - focus.framesRunning;
   } else if ((catScreenPt.x + CAMERA_RIGHT_BOUND) > pGameData->screen_width) {
     pGameData->scrollPoint.x -=
         pGameData->screen_width - CAMERA_RIGHT_BOUND - catScreenPt.x;
@@ -809,25 +1194,185 @@ void Tick(GameStateData* pGameData, ButState* buttons) {
   }
   /**/
 
+  // Neither cat can leave the shared screen
+  if (numCats == 2) {
+    for (int i = 0; i < numCats; ++i) {
+      CatData& cat = pGameData->Cat(i);
+      int left = pGameData->scrollPoint.x + CAT_HEIGHT;
+      int right =
+          pGameData->scrollPoint.x + pGameData->screen_width - CAT_HEIGHT;
+      if (cat.pos.x < left)
+        cat.pos.x = left;
+      else if (cat.pos.x > right)
+        cat.pos.x = right;
+    }
+  }
+
+  // Stream Level
+  StreamChunks(*pGameData);
+
   // Clear Press
-  buttons->up &= 1;
-  buttons->down &= 1;
-  buttons->left &= 1;
-  buttons->right &= 1;
+  for (int i = 0; i < numCats; ++i) {
+    buttons[i]->up &= 1;
+    buttons[i]->down &= 1;
+    buttons[i]->left &= 1;
+    buttons[i]->right &= 1;
+  }
+
+  // Effects
+  ParticlesUpdate(pGameData->pParticles);
 
   // Anim Step
-  ++s_animCount;
+  ++pGameData->animCount;
+}
+
+void Tick(GameStateData* pGameData, ButState* buttons) {
+  // A second cat, if any, stands still
+  ButState idle = {0, 0, 0, 0};
+  ButState* players[2] = {buttons, &idle};
+  TickGame(pGameData, players);
+}
+
+void TickVersus(GameStateData* pGameData, ButState* buttons,
+                ButState* buttons2) {
+  ButState* players[2] = {buttons, buttons2};
+  TickGame(pGameData, players);
+}
+
+/////// RENDER SNAPSHOT
+
+void GameCopyRenderState(GameStateData* pDst, GameStateData* pSrc) {
+  // Everything Render reads, laundry is shared not copied, no RNG
+  pDst->screen_width = pSrc->screen_width;
+  pDst->screen_height = pSrc->screen_height;
+  pDst->assets = pSrc->assets;
+  pDst->cat = pSrc->cat;
+  pDst->cat2 = pSrc->cat2;
+  pDst->numCats = pSrc->numCats;
+  pDst->scrollPoint = pSrc->scrollPoint;
+  pDst->level_bounds = pSrc->level_bounds;
+  pDst->seed = pSrc->seed;
+  for (int i = 0; i < MAX_RESIDENT_CHUNKS; ++i) pDst->chunks[i] = pSrc->chunks[i];
+  pDst->firstChunk = pSrc->firstChunk;
+  pDst->numChunks = pSrc->numChunks;
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    pDst->lines[y].offset = pSrc->lines[y].offset;
+    pDst->lines[y].scrollDir = pSrc->lines[y].scrollDir;
+    pDst->lines[y].lineHeight = pSrc->lines[y].lineHeight;
+    pDst->lines[y].pLaundry = pSrc->lines[y].pLaundry;
+  }
+  pDst->movingLine = pSrc->movingLine;
+  pDst->isLineMoving = pSrc->isLineMoving;
+  pDst->isMeowUnlocked = pSrc->isMeowUnlocked;
+  pDst->activeWindow = pSrc->activeWindow;
+  pDst->windowOpenTick = pSrc->windowOpenTick;
+  pDst->timers.now = pSrc->timers.now;
+  pDst->animCount = pSrc->animCount;
+  ParticlesCopy(pDst->pParticles, pSrc->pParticles);
+}
+
+/////// STATE HASH
+// FNV-1a over the simulated state, RNG is covered by what it has produced
+
+static void HashInt(uint32_t& h, int v) {
+  for (int i = 0; i < 4; ++i) {
+    h ^= (uint32_t)(v >> (i * 8)) & 0xFF;
+    h *= 16777619u;
+  }
+}
+
+static void HashCat(uint32_t& h, const TimerWheel& timers, const CatData& cat) {
+  HashInt(h, cat.state);
+  HashInt(h, cat.pos.x);
+  HashInt(h, cat.pos.y);
+  HashInt(h, cat.holdPos.x);
+  HashInt(h, cat.holdPos.y);
+  HashInt(h, cat.framesRunning);
+  HashInt(h, cat.upFrames);
+  HashInt(h, TimerRemaining(timers, cat.noLandTimer));
+  HashInt(h, cat.isRunning);
+  HashInt(h, cat.isGrounded);
+}
+
+uint32_t GameStateHash(GameStateData* pGameData) {
+  uint32_t h = 2166136261u;
+  HashCat(h, pGameData->timers, pGameData->cat);
+  if (pGameData->numCats == 2) {
+    HashCat(h, pGameData->timers, pGameData->cat2);
+    HashInt(h, pGameData->windowsWon[0]);
+    HashInt(h, pGameData->windowsWon[1]);
+  }
+
+  HashInt(h, pGameData->scrollPoint.x);
+  HashInt(h, pGameData->scrollPoint.y);
+  HashInt(h, pGameData->movingLine);
+  HashInt(h, pGameData->isLineMoving);
+  HashInt(h, TimerRemaining(pGameData->timers, pGameData->lineTimer));
+  HashInt(h, pGameData->activeWindow);
+  HashInt(h, pGameData->firstChunk);
+  HashInt(h, pGameData->windowOpenTick);
+  HashInt(h, TimerRemaining(pGameData->timers, pGameData->windowTimer));
+  HashInt(h, pGameData->timers.now);
+  HashInt(h, pGameData->animCount);
+
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    const LaundryLineData& line = pGameData->lines[y];
+    HashInt(h, line.offset);
+    HashInt(h, line.scrollDir);
+    const LaundryList& laundry = line.Laundry();
+    HashInt(h, (int)laundry.size());
+    for (size_t c = 0; c < laundry.size(); ++c) {
+      HashInt(h, laundry[c].xStep);
+      HashInt(h, laundry[c].laundryType);
+    }
+  }
+
+  return h;
 }
 
 ////////////////////////////////////////////////////////// RENDER FUNCTIONS
+// Spans are written a PixData::RunLength at a time, stepping with NextRun,
+// so everything draws the same into a linear or a tiled screen
+
+// Palette index 0 is see through
+static inline void PutPalette(uint16_t& pix, uint8_t index) {
+  switch (index) {
+    case 0:
+      break;
+    case 1:
+      pix = GBAColours[0];
+      break;
+    case 2:
+      pix = GBAColours[1];
+      break;
+    case 3:
+      pix = GBAColours[2];
+      break;
+    case 4:
+      pix = GBAColours[3];
+      break;
+    case 14:
+      pix = 0xF0F;
+      break;
+    default:
+      pix = 0xF00;
+      break;
+  }
+}
+
 void RenderFillRect(PixData& scrn, const Rect& origTarRect, uint16_t col) {
   Rect tarRect = scrn.size & origTarRect;
   if ((tarRect.w <= 0) || (tarRect.h <= 0)) return;
 
-  int c = scrn.GetI(Pt{tarRect.x, tarRect.y});
-  for (int y = 0; y < tarRect.h; ++y) {
-    for (int x = 0; x < tarRect.w; ++x) scrn.pixs[c++] = col;
-    c = c - tarRect.w + scrn.size.w;
+  int right = tarRect.x + tarRect.w;
+  for (int y = tarRect.y; y < tarRect.y + tarRect.h; ++y) {
+    int c = scrn.GetI(Pt{tarRect.x, y});
+    for (int x = tarRect.x; x < right;) {
+      int n = scrn.RunLength(x, right);
+      for (int i = 0; i < n; ++i) scrn.pixs[c + i] = col;
+      c = scrn.NextRun(c, n);
+      x += n;
+    }
   }
 }
 
@@ -888,34 +1433,18 @@ Rect RenderSpriteHorFlip(PixData& scrn, Pt topLeft, const SpriteData& sheet,
   srcRect.w = tarRect.w;
   srcRect.h = tarRect.h;
 
-  int c = scrn.GetI(Pt{tarRect.x, tarRect.y});
+  int right = tarRect.x + tarRect.w;
   for (int y = 0; y < srcRect.h; ++y) {
-    for (int x = 0; x < srcRect.w; ++x) {
-      switch (sheet.pixs[(srcRect.x - x) + (srcRect.y + y) * sheet.sprPitch]) {
-        case 0:
-          break;
-        case 1:
-          scrn.pixs[c] = GBAColours[0];
-          break;
-        case 2:
-          scrn.pixs[c] = GBAColours[1];
-          break;
-        case 3:
-          scrn.pixs[c] = GBAColours[2];
-          break;
-        case 4:
-          scrn.pixs[c] = GBAColours[3];
-          break;
-        case 14:
-          scrn.pixs[c] = 0xF0F;
-          break;
-        default:
-          scrn.pixs[c] = 0xF00;
-          break;
-      }
-      ++c;
+    const uint8_t* src =
+        sheet.pixs + srcRect.x + (srcRect.y + y) * sheet.sprPitch;
+    int c = scrn.GetI(Pt{tarRect.x, tarRect.y + y});
+    for (int x = tarRect.x; x < right;) {
+      int n = scrn.RunLength(x, right);
+      for (int i = 0; i < n; ++i) PutPalette(scrn.pixs[c + i], src[-i]);
+      c = scrn.NextRun(c, n);
+      src -= n;
+      x += n;
     }
-    c = c - srcRect.w + scrn.size.w;
   }
 
   return sprRect;
@@ -978,34 +1507,18 @@ Rect RenderSprite(PixData& scrn, Pt topLeft, const SpriteData& sheet,
   srcRect.w = tarRect.w;
   srcRect.h = tarRect.h;
 
-  int c = scrn.GetI(Pt{tarRect.x, tarRect.y});
+  int right = tarRect.x + tarRect.w;
   for (int y = 0; y < srcRect.h; ++y) {
-    for (int x = 0; x < srcRect.w; ++x) {
-      switch (sheet.pixs[(srcRect.x + x) + (srcRect.y + y) * sheet.sprPitch]) {
-        case 0:
-          break;
-        case 1:
-          scrn.pixs[c] = GBAColours[0];
-          break;
-        case 2:
-          scrn.pixs[c] = GBAColours[1];
-          break;
-        case 3:
-          scrn.pixs[c] = GBAColours[2];
-          break;
-        case 4:
-          scrn.pixs[c] = GBAColours[3];
-          break;
-        case 14:
-          scrn.pixs[c] = 0xF0F;
-          break;
-        default:
-          scrn.pixs[c] = 0xF00;
-          break;
-      }
-      ++c;
+    const uint8_t* src =
+        sheet.pixs + srcRect.x + (srcRect.y + y) * sheet.sprPitch;
+    int c = scrn.GetI(Pt{tarRect.x, tarRect.y + y});
+    for (int x = tarRect.x; x < right;) {
+      int n = scrn.RunLength(x, right);
+      for (int i = 0; i < n; ++i) PutPalette(scrn.pixs[c + i], src[i]);
+      c = scrn.NextRun(c, n);
+      src += n;
+      x += n;
     }
-    c = c - srcRect.w + scrn.size.w;
   }
 
   return sprRect;
@@ -1023,34 +1536,17 @@ void RenderBackground(PixData& scrn, Pt topLeft, const BackgroundData& bg) {
   srcRect.w = tarRect.w;
   srcRect.h = tarRect.h;
 
-  int c = scrn.GetI(Pt{tarRect.x, tarRect.y});
+  int right = tarRect.x + tarRect.w;
   for (int y = 0; y < srcRect.h; ++y) {
-    for (int x = 0; x < srcRect.w; ++x) {
-      switch (bg.pixs[(srcRect.x + x) + (srcRect.y + y) * bg.size.w]) {
-        case 0:
-          break;
-        case 1:
-          scrn.pixs[c] = GBAColours[0];
-          break;
-        case 2:
-          scrn.pixs[c] = GBAColours[1];
-          break;
-        case 3:
-          scrn.pixs[c] = GBAColours[2];
-          break;
-        case 4:
-          scrn.pixs[c] = GBAColours[3];
-          break;
-        case 14:
-          scrn.pixs[c] = 0xF0F;
-          break;
-        default:
-          scrn.pixs[c] = 0xF00;
-          break;
-      }
-      ++c;
+    const uint8_t* src = bg.pixs + srcRect.x + (srcRect.y + y) * bg.size.w;
+    int c = scrn.GetI(Pt{tarRect.x, tarRect.y + y});
+    for (int x = tarRect.x; x < right;) {
+      int n = scrn.RunLength(x, right);
+      for (int i = 0; i < n; ++i) PutPalette(scrn.pixs[c + i], src[i]);
+      c = scrn.NextRun(c, n);
+      src += n;
+      x += n;
     }
-    c = c - srcRect.w + scrn.size.w;
   }
 
   return;
@@ -1060,41 +1556,34 @@ void RenderBorderRect(PixData& scrn, const Rect& tarRect, uint16_t col,
                       int inset, int outset) {
   if ((tarRect.w <= 0) || (tarRect.h <= 0)) return;
 
-  int c = 0;
   Rect topLeft = scrn.size & Rect{tarRect.x - outset, tarRect.y - outset,
                                   outset + inset, outset + inset};
   Rect botRight = scrn.size & Rect{tarRect.x + tarRect.w - inset,
                                    tarRect.y + tarRect.h - inset,
                                    outset + inset, outset + inset};
+  int right = botRight.x + botRight.w;
+  int bottom = botRight.y + botRight.h;
 
-  if (topLeft.x < (botRight.x + botRight.w)) {
+  if (topLeft.x < right) {
     // TOP
-    for (int y = 0; y < topLeft.h; ++y) {
-      c = scrn.GetI(Pt{topLeft.x, topLeft.y + y});
-      for (int x = topLeft.x; x < (botRight.x + botRight.w); ++x)
-        scrn.pixs[c++] = col;
-    }
+    RenderFillRect(scrn, Rect{topLeft.x, topLeft.y, right - topLeft.x,
+                              topLeft.h}, col);
 
     // BOTTOM
-    for (int y = botRight.y; y < (botRight.y + botRight.h); ++y) {
-      c = scrn.GetI(Pt{topLeft.x, y});
-      for (int x = topLeft.x; x < (botRight.x + botRight.w); ++x)
-        scrn.pixs[c++] = col;
-    }
+    RenderFillRect(scrn, Rect{topLeft.x, botRight.y, right - topLeft.x,
+                              botRight.h}, col);
   }
 
-  for (int y = topLeft.y; y < (botRight.y + botRight.h); ++y) {
-    // LEFT
-	  if (topLeft.w > 0) {
-      c = scrn.GetI(Pt{topLeft.x, y});
-      for (int x = 0; x < topLeft.w; ++x) scrn.pixs[c++] = col;
-    }
+  // LEFT
+  if (topLeft.w > 0) {
+    RenderFillRect(scrn, Rect{topLeft.x, topLeft.y, topLeft.w,
+                              bottom - topLeft.y}, col);
+  }
 
-    // RIGHT
-    if (botRight.w > 0) {
-        c = scrn.GetI(Pt{botRight.x, y});
-        for (int x = 0; x < botRight.w; ++x) scrn.pixs[c++] = col;
-      }
+  // RIGHT
+  if (botRight.w > 0) {
+    RenderFillRect(scrn, Rect{botRight.x, topLeft.y, botRight.w,
+                              bottom - topLeft.y}, col);
   }
 }
 
@@ -1105,121 +1594,55 @@ void RenderBezelBoxFilled(PixData& scrn, const Rect& tarRect, uint16_t loCol,
 
   RenderFillRect(scrn, actualRect, midCol);
 
-  int c;
   int tlx, tly, brx, bry;
   tlx = actualRect.x;
   tly = actualRect.y;
   brx = actualRect.x + actualRect.w - 1;
   bry = actualRect.y + actualRect.h - 1;
 
-  if ((tarRect.y >= tly) && (tarRect.y <= bry)) {
-    c = scrn.GetI(Pt{tlx, tarRect.y});
-    for (int x = tlx; x < brx; ++x) {
-      scrn.pixs[c++] = hiCol;
-    }
-  }
+  if ((tarRect.y >= tly) && (tarRect.y <= bry))
+    RenderFillRect(scrn, Rect{tlx, tarRect.y, brx - tlx, 1}, hiCol);
 
   if (((tarRect.x + tarRect.w) >= tlx) &&
       ((tarRect.x + tarRect.w - 1) <= brx)) {
-    c = scrn.GetI(Pt{tarRect.x + tarRect.w - 1, tly});
-    for (int y = tly; y < bry; ++y) {
-      scrn.pixs[c] = hiCol;
-      c += scrn.size.w;
-    }
+    RenderFillRect(scrn, Rect{tarRect.x + tarRect.w - 1, tly, 1, bry - tly},
+                   hiCol);
   }
 
   if (((tarRect.y + tarRect.h) >= tly) &&
       ((tarRect.y + tarRect.h - 1) <= bry)) {
-    c = scrn.GetI(Pt{tlx, tarRect.y + tarRect.h - 1});
-    for (int x = tlx; x < brx; ++x) {
-      scrn.pixs[c++] = loCol;
-    }
+    RenderFillRect(scrn, Rect{tlx, tarRect.y + tarRect.h - 1, brx - tlx, 1},
+                   loCol);
   }
 
-  if ((tarRect.x >= tlx) && (tarRect.x <= brx)) {
-    c = scrn.GetI(Pt{tarRect.x, tly});
-    for (int y = tly; y < bry; ++y) {
-      scrn.pixs[c] = loCol;
-      c += scrn.size.w;
-    }
-  }
+  if ((tarRect.x >= tlx) && (tarRect.x <= brx))
+    RenderFillRect(scrn, Rect{tarRect.x, tly, 1, bry - tly}, loCol);
 }
 
 void RenderCat(PixData& scrn, Rect* srcRect, CatData& cat,
-               SpriteData& sprites) {
-  int l = 1;
-
+               const SpriteData& sprites, int animCount) {
   Pt topLeft = Pt{cat.pos.x, scrn.size.h - cat.pos.y};
 
-  switch (cat.state) {
-    case CatData::Idle:
-      l = sizeof(SPR_CAT_IDLE) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_IDLE[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::Left:
-      l = sizeof(SPR_CAT_WALK) / sizeof(int);
-      RenderSpriteHorFlip(scrn, topLeft, sprites,
-                          SPR_CAT_WALK[s_animCount / 7 % l],
-                          SpriteData::BOTTOM);
-      break;
-
-    case CatData::Right:
-      l = sizeof(SPR_CAT_WALK) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_WALK[s_animCount / 7 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::Up:
-      l = sizeof(SPR_CAT_UP) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_UP[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::PounceLeft:
-      l = sizeof(SPR_CAT_POUNCE) / sizeof(int);
-      RenderSpriteHorFlip(scrn, topLeft, sprites,
-                          SPR_CAT_POUNCE[s_animCount / 10 % l],
-                          SpriteData::BOTTOM);
-      break;
-
-    case CatData::PounceRight:
-      l = sizeof(SPR_CAT_POUNCE) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_POUNCE[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::Down:
-      l = sizeof(SPR_CAT_DOWN) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_DOWN[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::DownLeft:
-      l = sizeof(SPR_CAT_POUNCE_DOWN) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites,
-                   SPR_CAT_POUNCE_DOWN[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-
-    case CatData::DownRight:
-      l = sizeof(SPR_CAT_POUNCE_DOWN) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites,
-                   SPR_CAT_POUNCE_DOWN[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
+  bool isFlipped;
+  int sprite = CatSprite(cat, animCount, isFlipped);
+  if (isFlipped)
+    RenderSpriteHorFlip(scrn, topLeft, sprites, sprite, SpriteData::BOTTOM);
+  else
+    RenderSprite(scrn, topLeft, sprites, sprite, SpriteData::BOTTOM);
+}
 
-    case CatData::Hold:
-      l = sizeof(SPR_CAT_HOLD) / sizeof(int);
-      RenderSprite(scrn, topLeft, sprites, SPR_CAT_HOLD[s_animCount / 10 % l],
-                   SpriteData::BOTTOM);
-      break;
-  }
+// Active window opens, stays open, then closes as its time runs out
+int WindowAnimFrame(int windowOpenTime) {
+  int lengthOfWindowAnim = sizeof(SPR_WINDOW_CAT) / sizeof(int);
+  if (windowOpenTime < lengthOfWindowAnim) return windowOpenTime;
+  if (windowOpenTime <= (WINDOW_OPEN_TIME - lengthOfWindowAnim))
+    return lengthOfWindowAnim - 1;
+  return WINDOW_OPEN_TIME - windowOpenTime;
 }
 
-void RenderDEBUGSPRITE(PixData& scrn, SpriteData& sprites) {
-  Pt c = Pt{1, -(s_animCount / 10) % scrn.size.h};
+void RenderDEBUGSPRITE(PixData& scrn, const SpriteData& sprites,
+                       int animCount) {
+  Pt c = Pt{1, -(animCount / 10) % scrn.size.h};
 
   int mh = 0;
 
@@ -1246,27 +1669,77 @@ void RenderDEBUGSPRITE(PixData& scrn, SpriteData& sprites) {
   }
 }
 
-void Render(GameStateData* pGameData, uint16_t* pixs, Rect* srcRect) {
-  PixData screen =
-      PixData{pixs, Rect{pGameData->scrollPoint.x, pGameData->scrollPoint.y,
-                         srcRect->w, srcRect->h}};
+// Everything Render draws from, anim counters reduced to the frame shown
+uint32_t GameRenderKey(GameStateData* pGameData) {
+  uint32_t h = 2166136261u;
+  bool isFlipped;
+  HashInt(h, pGameData->scrollPoint.x);
+  HashInt(h, pGameData->scrollPoint.y);
+  HashInt(h, pGameData->cat.pos.x);
+  HashInt(h, pGameData->cat.pos.y);
+  HashInt(h, CatSprite(pGameData->cat, pGameData->animCount, isFlipped));
+  HashInt(h, isFlipped);
+  if (pGameData->numCats == 2) {
+    HashInt(h, pGameData->cat2.pos.x);
+    HashInt(h, pGameData->cat2.pos.y);
+    HashInt(h, CatSprite(pGameData->cat2, pGameData->animCount, isFlipped));
+    HashInt(h, isFlipped);
+  }
+
+  HashInt(h, pGameData->firstChunk);
+  HashInt(h, pGameData->numChunks);
+  HashInt(h, pGameData->isMeowUnlocked);
+  HashInt(h, pGameData->activeWindow);
+  HashInt(h,
+          WindowAnimFrame(pGameData->timers.now - pGameData->windowOpenTick));
+
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    const LaundryLineData& line = pGameData->lines[y];
+    HashInt(h, line.offset);
+    const LaundryList& laundry = line.Laundry();
+    HashInt(h, (int)laundry.size());
+    for (size_t c = 0; c < laundry.size(); ++c) {
+      HashInt(h, laundry[c].xStep);
+      HashInt(h, laundry[c].laundryType);
+    }
+  }
+
+  // Live particles move every tick
+  if (pGameData->pParticles && (pGameData->pParticles->count > 0))
+    HashInt(h, pGameData->timers.now);
+
+  // Reloaded art looks different with everything else the same
+  uint64_t assets = (uint64_t)(uintptr_t)pGameData->assets;
+  HashInt(h, (int)assets);
+  HashInt(h, (int)(assets >> 32));
+
+  return h;
+}
 
+static void RenderScreen(GameStateData* pGameData, PixData& screen,
+                         Rect* srcRect) {
   // Clear Board
   RenderFillRect(screen, screen.size,
                  GBAColours[1]);  //  + ((animCount / 10) % 5)
 
   // Building
-  int lengthOfWindowAnim = sizeof(SPR_WINDOW_CAT) / sizeof(int);
+  int windowOpenTime = pGameData->timers.now - pGameData->windowOpenTick;
   for (int y = 0; y < 4; ++y) {
     // Clothes Line
     Pt startPt =
         Pt{screen.size.x, screen.size.h - pGameData->lines[y].lineHeight};
     if (in(screen.size, startPt)) {
-      int c = screen.GetI(startPt);
       int tog = startPt.x % 2;
-      for (int x = 0; x < screen.size.w; ++x) {
-        screen.pixs[c++] = GBAColours[tog * 2];
-        tog ^= 1;
+      int right = screen.size.x + screen.size.w;
+      int c = screen.GetI(startPt);
+      for (int x = startPt.x; x < right;) {
+        int n = screen.RunLength(x, right);
+        for (int i = 0; i < n; ++i) {
+          screen.pixs[c + i] = GBAColours[tog * 2];
+          tog ^= 1;
+        }
+        c = screen.NextRun(c, n);
+        x += n;
       }
     }
 
@@ -1282,88 +1755,99 @@ void Render(GameStateData* pGameData, uint16_t* pixs, Rect* srcRect) {
     //}
 
     // Windows
-    for (int x = 0; x < 4; ++x) {
-      int animFrame = 0;
-
-      if (x + y * 4 == pGameData->activeWindow) {
-        if (pGameData->windowOpenTime < lengthOfWindowAnim)
-          animFrame = pGameData->windowOpenTime;
-        else if (pGameData->windowOpenTime <=
-                 (WINDOW_OPEN_TIME - lengthOfWindowAnim)) {
-          animFrame = lengthOfWindowAnim - 1;
+    for (int i = 0; i < pGameData->numChunks; ++i) {
+      const LevelChunk& chunk = pGameData->Chunk(i);
+      for (int w = 0; w < WINDOWS_PER_CHUNK; ++w) {
+        if (((chunk.windowRows[w] >> y) & 1) == 0) continue;
+
+        int window =
+            (chunk.index * WINDOWS_PER_CHUNK + w) * NUM_LAUNDRY_LINES + y;
+        int animFrame = 0;
+
+        if (window == pGameData->activeWindow)
+          animFrame = WindowAnimFrame(windowOpenTime);
+
+        Rect windowRect = WindowRect(*pGameData, window);
+        Pt bottomLeft = Pt{windowRect.x, screen.size.h - windowRect.y};
+        if (pGameData->isMeowUnlocked) {
+          RenderSprite(screen, bottomLeft, pGameData->assets->sprites,
+                       SPR_WINDOW_CAT[animFrame], SpriteData::BOTTOM_LEFT);
         } else {
-          animFrame = WINDOW_OPEN_TIME - pGameData->windowOpenTime;
+          RenderSprite(screen, bottomLeft, pGameData->assets->sprites,
+                       SPR_WINDOW_EMPTY[animFrame], SpriteData::BOTTOM_LEFT);
         }
       }
-
-      if (pGameData->isMeowUnlocked) {
-        RenderSprite(screen,
-                     Pt{20 + 80 * x,
-                        screen.size.h - pGameData->lines[y].lineHeight + 26},
-                     pGameData->sprites, SPR_WINDOW_CAT[animFrame],
-                     SpriteData::BOTTOM_LEFT);
-      } else {
-        RenderSprite(screen,
-                     Pt{20 + 80 * x,
-                        screen.size.h - pGameData->lines[y].lineHeight + 26},
-                     pGameData->sprites, SPR_WINDOW_EMPTY[animFrame],
-                     SpriteData::BOTTOM_LEFT);
-      }
     }
 
     // Clothes
     int x = pGameData->lines[y].offset;
-    int maxL = pGameData->lines[y].laundry.size();
+    const LaundryList& laundry = pGameData->lines[y].Laundry();
+    int maxL = laundry.size();
     for (int c = 0; c < maxL; ++c) {
-      auto l = pGameData->lines[y].laundry[c];
+      auto l = laundry[c];
       RenderSprite(screen,
                    Pt{x, screen.size.h - pGameData->lines[y].lineHeight - 1},
-                   pGameData->sprites, SPR_LAUNDRY[l.laundryType]);
+                   pGameData->assets->sprites, SPR_LAUNDRY[l.laundryType]);
       x += l.xStep;
     }
   }
 
-  // Fence
-  RenderBackground(screen, Pt{0, screen.size.h - pGameData->floor.size.h},
-                   pGameData->floor);
+  // Fence, tiled along the alley
+  const BackgroundData& floor = pGameData->assets->floor;
+  if (floor.size.w > 0) {
+    for (int x = screen.size.x - (screen.size.x % floor.size.w);
+         x < screen.size.x + screen.size.w; x += floor.size.w) {
+      RenderBackground(screen, Pt{x, screen.size.h - floor.size.h}, floor);
+    }
+  }
 
   // Score
   Pt cur = Pt{24 + 16, screen.size.h - 79};
   int scoreBlank[8] = {0, 0, 0, 10, 0, 0, 0, 0};
   for (int i = 0; i < 8; ++i) {
     // screen.pixs[screen.GetI(cur)] = 0xF00;
-    int padLeft = (8 - pGameData->sprites.sprRect[scoreBlank[i]].w) / 2;
+    int padLeft = (8 - pGameData->assets->sprites.sprRect[scoreBlank[i]].w) / 2;
     cur.x += padLeft;
-    Rect res = RenderSprite(screen, cur, pGameData->sprites, scoreBlank[i]);
+    Rect res = RenderSprite(screen, cur, pGameData->assets->sprites, scoreBlank[i]);
     cur.x += 8 - padLeft;  // res.w + 1;
   }
 
   // Render Bins
-  for (size_t i = 0; i < pGameData->bins.size(); ++i) {
-    Rect binRect = pGameData->bins[i];
+  for (int i = 0; i < pGameData->numChunks; ++i) {
+    const LevelChunk& chunk = pGameData->Chunk(i);
+    for (int b = 0; b < chunk.numBins; ++b) {
+      Rect binRect = chunk.bins[b];
+
+      Pt curr = Pt{binRect.x, screen.size.h - binRect.y};
+      int yTop = curr.y - binRect.h + 15;
+      while (curr.y > yTop) {
+        RenderSprite(screen, curr, pGameData->assets->sprites, SPR_BIN_MID[0],
+                     SpriteData::BOTTOM_LEFT);
+        curr.y -= 8;
+      }
 
-    Pt curr = Pt{binRect.x, screen.size.h - binRect.y};
-    int yTop = curr.y - binRect.h + 15;
-    while (curr.y > yTop) {
-      RenderSprite(screen, curr, pGameData->sprites, SPR_BIN_MID[0],
+      curr.y -= 10;
+      RenderSprite(screen, curr, pGameData->assets->sprites, SPR_BIN_TOP[0],
                    SpriteData::BOTTOM_LEFT);
-      curr.y -= 8;
-    }
 
-    curr.y -= 10;
-    RenderSprite(screen, curr, pGameData->sprites, SPR_BIN_TOP[0],
-                 SpriteData::BOTTOM_LEFT);
+      // Render Trash Cat
 
-    // Render Trash Cat
-
-    // Covering bit
-    curr.y += 10;
-    RenderSprite(screen, curr, pGameData->sprites, SPR_BIN_MID[0],
-                 SpriteData::BOTTOM_LEFT);
+      // Covering bit
+      curr.y += 10;
+      RenderSprite(screen, curr, pGameData->assets->sprites, SPR_BIN_MID[0],
+                   SpriteData::BOTTOM_LEFT);
+    }
   }
 
   // Cat
-  RenderCat(screen, srcRect, pGameData->cat, pGameData->sprites);
+  RenderCat(screen, srcRect, pGameData->cat, pGameData->assets->sprites,
+            pGameData->animCount);
+  if (pGameData->numCats == 2)
+    RenderCat(screen, srcRect, pGameData->cat2, pGameData->assets->sprites,
+              pGameData->animCount);
+
+  // Effects
+  ParticlesRender(pGameData->pParticles, screen);
 
   /*
   if (pGameData->cat.upFrames > 0) {
@@ -1388,8 +1872,46 @@ void Render(GameStateData* pGameData, uint16_t* pixs, Rect* srcRect) {
   /**/
 }
 
+void Render(GameStateData* pGameData, uint16_t* pixs, Rect* srcRect) {
+  PixData screen =
+      PixData{pixs, Rect{pGameData->scrollPoint.x, pGameData->scrollPoint.y,
+                         srcRect->w, srcRect->h}, false};
+  RenderScreen(pGameData, screen, srcRect);
+}
+
+void RenderTiled(GameStateData* pGameData, uint16_t* tiles, Rect* srcRect) {
+  PixData screen =
+      PixData{tiles, Rect{pGameData->scrollPoint.x, pGameData->scrollPoint.y,
+                          srcRect->w, srcRect->h}, true};
+  RenderScreen(pGameData, screen, srcRect);
+}
+
 // DEBUG
 void DebugPt(GameStateData* pGameData, Pt m) {
   SDL_Log("Mouse [%d,%d] -> [%d,%d]", m.x, m.y, m.x + pGameData->scrollPoint.x,
           m.y + pGameData->scrollPoint.y);
-}
\ No newline at end of file
+}
+
+void RenderSpriteBench(GameStateData* pGameData, uint16_t* pixs,
+                       Rect* srcRect, int numSprites, uint32_t seed,
+                       bool isTiled) {
+  PixData screen =
+      PixData{pixs, Rect{0, 0, srcRect->w, srcRect->h}, isTiled};
+  const SpriteData& sprites = pGameData->assets->sprites;
+  RenderFillRect(screen, screen.size, GBAColours[1]);
+
+  // xorshift32, some sprites hang off the edges
+  uint32_t r = seed | 1;
+  for (int i = 0; i < numSprites; ++i) {
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    size_t sprID = (r >> 24) % sprites.sprRect.size();
+    Pt at = Pt{(int)(r & 0xFF) % (screen.size.w + 32) - 16,
+               (int)((r >> 8) & 0xFF) % (screen.size.h + 32) - 16};
+    if ((r >> 16) & 1)
+      RenderSpriteHorFlip(screen, at, sprites, sprID);
+    else
+      RenderSprite(screen, at, sprites, sprID);
+  }
+}
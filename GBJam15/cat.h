@@ -1,8 +1,11 @@
+#pragma once
 #include "SDL.h"
 
 extern "C" {
 
 struct GameStateData;
+struct GameAssets;
+struct JobSystem;
 
 class Rect {
  public:
@@ -19,11 +22,76 @@ class ButState {
   int up, down, left, right;
 };
 
-GameStateData* GameSetup(uint16_t width, uint16_t height);
+// Held buttons as bits: up 1, down 2, left 4, right 8
+int GameButtonBits(const ButState& buttons);
+
+// Newly held buttons count as pressed this tick like a key down
+ButState GameHeldButtons(int held, int wasHeld);
+
+// Sound effects a tick can ask for
+enum GameSound { SND_JUMP, SND_LAND, SND_POUNCE, SND_FIGHT, SND_COUNT };
+
+// nullptr if the assets don't load
+GameStateData* GameSetup(uint16_t width, uint16_t height, uint32_t seed);
+
+// Shared read-only sprites/background, load once for many games. nullptr if
+// the sheet is missing or short of sprites, a missing floor is left blank
+GameAssets* GameLoadAssets(const char* spriteFile, const char* floorFile);
+GameAssets* GameLoadAssetsWithJobs(JobSystem* pJobs, const char* spriteFile,
+                                   const char* floorFile);
+// Only for GameLoadAssets*, an atlas points into its mapping and stays
+void GameAssetsDestroy(GameAssets* pAssets);
+GameStateData* GameSetupWithAssets(const GameAssets* pAssets, uint16_t width,
+                                   uint16_t height, uint32_t seed);
+uint32_t GameGetSeed(GameStateData* pGameState);
+
+// Draw and collide with other art from the next tick on (hot reloading)
+void GameSetAssets(GameStateData* pGameState, const GameAssets* pAssets);
+
+// The 4 colours Render draws with, darkest first
+uint16_t GamePaletteColour(int i);
+
+// Nearest palette index for each of the 4096 RGB444 values, so anything
+// Render draws maps back to the index it came from
+void GamePaletteIndexTable(uint8_t* toIndex);
+void GameDestroy(GameStateData* pGameState);
+
+// Independent copy to simulate ahead from, sharing laundry until either side
+// changes it. Effects stay with their game (a new fork has none) and forking
+// into an existing game reuses it without allocating.
+GameStateData* GameFork(GameStateData* pGameState);
+void GameForkInto(GameStateData* pDst, GameStateData* pSrc);
 
 void Tick(GameStateData* pGameState, ButState* buttons);
+
+// Two player games, a second cat starts beside the first and both share the
+// screen. Tick then only moves the first cat, TickVersus moves both.
+void GameAddSecondCat(GameStateData* pGameState);
+void TickVersus(GameStateData* pGameState, ButState* buttons,
+                ButState* buttons2);
+int GameWindowsWon(GameStateData* pGameState, int cat);
 void Render(GameStateData* pGameState, uint16_t* pixs, Rect* srcRect);
 
+// The same frame into an 8x8 tiled buffer, see tiles.h
+void RenderTiled(GameStateData* pGameState, uint16_t* tiles, Rect* srcRect);
+
+// 1 << GameSound bits raised by Tick since the last call
+uint32_t GameTakeSounds(GameStateData* pGameState);
+
+// Copy only what Render needs into another game (e.g. for a render thread)
+void GameCopyRenderState(GameStateData* pDst, GameStateData* pSrc);
+
+// Cheap hash of the simulated state for catching replay divergence
+uint32_t GameStateHash(GameStateData* pGameState);
+
+// Changes whenever the rendered frame would, for skipping identical frames
+uint32_t GameRenderKey(GameStateData* pGameState);
+
 // DEBUG
 void DebugPt(GameStateData* pGameState, Pt m);
+
+// numSprites sprites scattered by seed, for timing the screen layouts
+void RenderSpriteBench(GameStateData* pGameState, uint16_t* pixs,
+                       Rect* srcRect, int numSprites, uint32_t seed,
+                       bool isTiled);
 };
\ No newline at end of file
@@ -0,0 +1,66 @@
+#include "collision.h"
+#include "gamestate.h"
+#include <algorithm>
+
+void BuildSpriteMasks(SpriteData& sprites) {
+  int numSprites = (int)sprites.sprRect.size();
+  sprites.maskFirst.resize(numSprites);
+  int numRows = 0;
+  for (int i = 0; i < numSprites; ++i) {
+    sprites.maskFirst[i] = numRows;
+    numRows += sprites.sprRect[i].h * 2;
+  }
+  sprites.maskRows.assign(numRows, 0);
+
+  for (int i = 0; i < numSprites; ++i) BuildSpriteMask(sprites, i);
+}
+
+void BuildSpriteMask(SpriteData& sprites, int sprID) {
+  const Rect& r = sprites.sprRect[sprID];
+  if (r.h <= 0) return;
+  uint64_t* rows = &sprites.maskRows[sprites.maskFirst[sprID]];
+  uint64_t* flipped = rows + r.h;
+
+  // Palette index 0 is see through, as in RenderSprite. Every column, a
+  // sprite wider than the mask keeps its left columns in rows and its right
+  // ones (mirrored to the left) in flipped
+  for (int y = 0; y < r.h; ++y) {
+    const uint8_t* src = sprites.pixs + r.x + (r.y + y) * sprites.sprPitch;
+    rows[y] = flipped[y] = 0;
+    for (int x = 0; x < r.w; ++x) {
+      if (src[x] == 0) continue;
+      if (x < MAX_MASK_WIDTH) rows[y] |= (uint64_t)1 << x;
+      if (r.w - 1 - x < MAX_MASK_WIDTH)
+        flipped[y] |= (uint64_t)1 << (r.w - 1 - x);
+    }
+  }
+}
+
+const uint64_t* SpriteMask(const SpriteData& sprites, int sprID,
+                           bool isFlipped) {
+  // Pointer arithmetic not [], an empty sprite last in the list starts at
+  // the end of maskRows. Its rect is empty so MasksOverlap never reads it
+  const uint64_t* rows = sprites.maskRows.data() + sprites.maskFirst[sprID];
+  return isFlipped ? rows + sprites.sprRect[sprID].h : rows;
+}
+
+bool MasksOverlap(const uint64_t* a, const Rect& aRect, const uint64_t* b,
+                  const Rect& bRect) {
+  int top = std::max(aRect.y, bRect.y);
+  int bottom = std::min(aRect.y + aRect.h, bRect.y + bRect.h);
+  int left = std::max(aRect.x, bRect.x);
+  int right = std::min(aRect.x + aRect.w, bRect.x + bRect.w);
+  if ((bottom <= top) || (right <= left)) return false;
+
+  // b's columns moved into a's
+  int shift = bRect.x - aRect.x;
+  if ((shift >= MAX_MASK_WIDTH) || (shift <= -MAX_MASK_WIDTH)) return false;
+
+  a += top - aRect.y;
+  b += top - bRect.y;
+  for (int y = 0; y < bottom - top; ++y) {
+    uint64_t row = (shift >= 0) ? (b[y] << shift) : (b[y] >> -shift);
+    if (a[y] & row) return true;
+  }
+  return false;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "cat.h"
+#include <stdint.h>
+
+struct SpriteData;
+
+// Pixel perfect hit tests. Every sprite gets a 1-bit mask of its opaque
+// pixels when the sheet loads, one uint64 per row with bit x for column x,
+// so after the usual rect test two sprites cost a shift and an AND per row
+// they share. Sprites wider than MAX_MASK_WIDTH only collide on their left
+// MAX_MASK_WIDTH columns.
+const int MAX_MASK_WIDTH = 64;
+
+// Fills sprites.maskRows and maskFirst from the pixels and rects
+void BuildSpriteMasks(SpriteData& sprites);
+
+// Redoes one sprite's mask in place after its pixels changed
+void BuildSpriteMask(SpriteData& sprites, int sprID);
+
+// Rows of sprID's mask, mirrored if it's drawn with RenderSpriteHorFlip
+const uint64_t* SpriteMask(const SpriteData& sprites, int sprID,
+                           bool isFlipped);
+
+// Masks with their top left corners at the rects', true if any bits meet
+bool MasksOverlap(const uint64_t* a, const Rect& aRect, const uint64_t* b,
+                  const Rect& bRect);
@@ -0,0 +1,2661 @@
+// Generated by headless -embed from sprites.bmp and floor.bmp, don't edit
+// Source hash fc346b01
+#include "atlas.h"
+
+#ifdef _MSC_VER
+#define ATLAS_ALIGNED __declspec(align(64))
+#else
+#define ATLAS_ALIGNED __attribute__((aligned(64)))
+#endif
+
+extern const size_t EMBEDDED_ATLAS_SIZE = 63552;
+ATLAS_ALIGNED extern const uint64_t EMBEDDED_ATLAS[7944] = {
+    0x0000000254414247ull, 0x0000003b0000f840ull, 0x0000058e00000013ull,
+    0x0000014000000040ull, 0x0000005d00000140ull, 0x0000050000000040ull,
+    0x0000340000000780ull, 0xfc346b0100008400ull, 0x0000000000000018ull,
+    0x0000000800000007ull, 0x0000001f00000000ull, 0x0000000300000000ull,
+    0x0000001000000008ull, 0x0000000000000022ull, 0x0000000800000005ull,
+    0x0000002700000020ull, 0x0000000600000000ull, 0x0000003000000008ull,
+    0x000000000000002dull, 0x0000000800000007ull, 0x0000003400000040ull,
+    0x0000000500000000ull, 0x0000005000000008ull, 0x0000000000000039ull,
+    0x0000000800000006ull, 0x0000002b00000060ull, 0x0000000600000008ull,
+    0x0000007000000008ull, 0x0000000800000031ull, 0x0000000800000006ull,
+    0x0000003700000080ull, 0x0000000700000008ull, 0x0000009000000008ull,
+    0x000000180000001eull, 0x0000000800000004ull, 0x00000036000000a0ull,
+    0x0000000a00000024ull, 0x000000b000000009ull, 0x000000e400000000ull,
+    0x000000090000000dull, 0x0000000d000000c2ull, 0x0000000f000000e4ull,
+    0x000000d400000009ull, 0x000000e40000001cull, 0x000000080000000full,
+    0x0000002b000000e6ull, 0x0000000f000000e4ull, 0x000000f600000008ull,
+    0x0000002400000000ull, 0x0000001000000028ull, 0x0000000000000106ull,
+    0x0000002800000034ull, 0x0000012600000010ull, 0x0000004400000000ull,
+    0x0000001000000028ull, 0x0000000000000146ull, 0x0000002800000054ull,
+    0x0000016600000010ull, 0x0000006400000000ull, 0x0000001000000028ull,
+    0x0000000000000186ull, 0x0000002800000074ull, 0x000001a600000010ull,
+    0x0000008400000000ull, 0x0000001000000028ull, 0x00000000000001c6ull,
+    0x0000002800000094ull, 0x000001e600000010ull, 0x000000a400000000ull,
+    0x0000001000000028ull, 0x0000000000000206ull, 0x00000028000000b4ull,
+    0x0000022600000010ull, 0x000000c400000000ull, 0x0000001000000028ull,
+    0x0000000000000246ull, 0x00000028000000d4ull, 0x0000026600000010ull,
+    0x000000ed00000000ull, 0x0000000a0000002full, 0x0000001000000286ull,
+    0x0000001b00000008ull, 0x0000029a0000000eull, 0x0000001800000000ull,
+    0x0000000c0000001eull, 0x00000022000002b6ull, 0x0000000e00000018ull,
+    0x000002ce0000000cull, 0x0000001800000030ull, 0x0000000c0000000eull,
+    0x00000028000002e6ull, 0x0000000e00000024ull, 0x000002fe0000000cull,
+    0x0000003400000028ull, 0x0000000c0000000eull, 0x0000002800000316ull,
+    0x0000000e00000044ull, 0x0000032e0000000cull, 0x0000005400000028ull,
+    0x0000000c0000000eull, 0x0000002800000346ull, 0x0000000e00000064ull,
+    0x0000035e0000000cull, 0x0000007400000028ull, 0x0000000c0000000eull,
+    0x0000002800000376ull, 0x0000001800000084ull, 0x0000038e0000000bull,
+    0x0000009400000028ull, 0x0000000b00000018ull, 0x00000028000003a4ull,
+    0x00000015000000a4ull, 0x000003ba0000000bull, 0x000000b400000028ull,
+    0x0000000b00000017ull, 0x00000028000003d0ull, 0x00000012000000c4ull,
+    0x000003e60000000eull, 0x000000f700000000ull, 0x0000000e00000012ull,
+    0x0000002800000402ull, 0x00000012000000d4ull, 0x0000041e0000000eull,
+    0x000000f700000012ull, 0x0000000e00000016ull, 0x000000280000043aull,
+    0x00000016000000f7ull, 0x000004560000000eull, 0x0000010500000000ull,
+    0x0000000e00000017ull, 0x0000001700000472ull, 0x0000001800000105ull,
+    0x0000048e0000000eull, 0x0000011300000000ull, 0x0000000f00000020ull,
+    0x00000020000004aaull, 0x0000002000000113ull, 0x000004c80000000full,
+    0x0000012200000000ull, 0x0000000f00000020ull, 0x00000020000004e6ull,
+    0x0000002000000122ull, 0x000005040000000full, 0x0000013100000000ull,
+    0x0000000f00000020ull, 0x0000000000000522ull, 0x0000000600000000ull,
+    0x0000054000000008ull, 0x0000000000000006ull, 0x0000000800000006ull,
+    0x0000000c00000550ull, 0x0000000c00000000ull, 0x0000056000000007ull,
+    0x0000000800000000ull, 0x0000001000000010ull, 0x000000000000056eull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00000000004d554eull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000b00000000ull, 0x44495f4553554f4dull,
+    0x000000000000454cull, 0x0000000000000000ull, 0x000000010000000bull,
+    0x55525f4553554f4dull, 0x000000000000004eull, 0x0000000000000000ull,
+    0x000000020000000cull, 0x00000000444f4f46ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x000000020000000eull, 0x0000574f444e4957ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000c00000010ull,
+    0x00004b4545555153ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x000000010000001cull, 0x0044494d5f4e4942ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x000000010000001dull, 0x00504f545f4e4942ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x000000010000001eull,
+    0x454c44495f544143ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x000000080000001full, 0x4b4c41575f544143ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000400000027ull, 0x000050555f544143ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x000000010000002bull,
+    0x444c4f485f544143ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x000000010000002cull, 0x4e574f445f544143ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x000000010000002dull, 0x000000315f544143ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x000000010000002eull,
+    0x4e554f505f544143ull, 0x0000000000004543ull, 0x0000000000000000ull,
+    0x000000010000002full, 0x4e554f505f544143ull, 0x004e574f445f4543ull,
+    0x0000000000000000ull, 0x0000000200000030ull, 0x0000000000474f44ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000200000032ull,
+    0x0000005448474946ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000300000034ull, 0x005952444e55414cull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000400000037ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x000000000000000eull, 0x000000000000001bull, 0x0000000000000013ull,
+    0x0000000000000033ull, 0x0000000000000066ull, 0x0000000000000066ull,
+    0x000000000000007cull, 0x0000000000000038ull, 0x0000000000000038ull,
+    0x000000000000006cull, 0x0000000000000064ull, 0x0000000000000066ull,
+    0x0000000000000033ull, 0x0000000000000033ull, 0x000000000000001full,
+    0x000000000000000eull, 0x0000000000000003ull, 0x0000000000000003ull,
+    0x0000000000000003ull, 0x0000000000000003ull, 0x0000000000000007ull,
+    0x0000000000000006ull, 0x0000000000000006ull, 0x0000000000000006ull,
+    0x0000000000000006ull, 0x0000000000000006ull, 0x0000000000000006ull,
+    0x0000000000000006ull, 0x0000000000000007ull, 0x0000000000000003ull,
+    0x0000000000000003ull, 0x0000000000000003ull, 0x000000000000000eull,
+    0x000000000000001full, 0x0000000000000018ull, 0x000000000000000eull,
+    0x0000000000000007ull, 0x0000000000000003ull, 0x000000000000000full,
+    0x000000000000001full, 0x000000000000000eull, 0x000000000000001full,
+    0x0000000000000003ull, 0x000000000000000eull, 0x000000000000001cull,
+    0x0000000000000018ull, 0x000000000000001eull, 0x000000000000001full,
+    0x000000000000000eull, 0x000000000000001full, 0x000000000000001bull,
+    0x0000000000000018ull, 0x000000000000003cull, 0x0000000000000030ull,
+    0x0000000000000036ull, 0x000000000000001cull, 0x000000000000001cull,
+    0x000000000000003eull, 0x0000000000000036ull, 0x0000000000000006ull,
+    0x000000000000000full, 0x0000000000000003ull, 0x000000000000001bull,
+    0x000000000000000eull, 0x0000000000000000ull, 0x0000000000000030ull,
+    0x0000000000000033ull, 0x000000000000007bull, 0x000000000000003full,
+    0x0000000000000036ull, 0x0000000000000030ull, 0x0000000000000030ull,
+    0x0000000000000000ull, 0x0000000000000006ull, 0x0000000000000066ull,
+    0x000000000000006full, 0x000000000000007eull, 0x0000000000000036ull,
+    0x0000000000000006ull, 0x0000000000000006ull, 0x000000000000001full,
+    0x0000000000000013ull, 0x0000000000000003ull, 0x000000000000000full,
+    0x000000000000001cull, 0x0000000000000018ull, 0x000000000000001bull,
+    0x000000000000000eull, 0x000000000000001full, 0x0000000000000019ull,
+    0x0000000000000018ull, 0x000000000000001eull, 0x0000000000000007ull,
+    0x0000000000000003ull, 0x000000000000001bull, 0x000000000000000eull,
+    0x000000000000001cull, 0x000000000000000eull, 0x0000000000000006ull,
+    0x000000000000001full, 0x000000000000003full, 0x0000000000000033ull,
+    0x000000000000003full, 0x000000000000000eull, 0x000000000000000eull,
+    0x000000000000001cull, 0x0000000000000018ull, 0x000000000000003eull,
+    0x000000000000003full, 0x0000000000000033ull, 0x000000000000003full,
+    0x000000000000001cull, 0x000000000000003cull, 0x000000000000003full,
+    0x0000000000000033ull, 0x0000000000000030ull, 0x0000000000000038ull,
+    0x0000000000000018ull, 0x0000000000000018ull, 0x0000000000000018ull,
+    0x000000000000000full, 0x000000000000003full, 0x0000000000000033ull,
+    0x0000000000000003ull, 0x0000000000000007ull, 0x0000000000000006ull,
+    0x0000000000000006ull, 0x0000000000000006ull, 0x000000000000001cull,
+    0x0000000000000036ull, 0x0000000000000036ull, 0x000000000000001cull,
+    0x000000000000000eull, 0x000000000000001bull, 0x000000000000001bull,
+    0x000000000000000eull, 0x000000000000000eull, 0x000000000000001bull,
+    0x000000000000001bull, 0x000000000000000eull, 0x000000000000001cull,
+    0x0000000000000036ull, 0x0000000000000036ull, 0x000000000000001cull,
+    0x000000000000001eull, 0x000000000000003full, 0x0000000000000073ull,
+    0x000000000000007full, 0x000000000000006eull, 0x0000000000000060ull,
+    0x0000000000000038ull, 0x0000000000000018ull, 0x000000000000003cull,
+    0x000000000000007eull, 0x0000000000000067ull, 0x000000000000007full,
+    0x000000000000003bull, 0x0000000000000003ull, 0x000000000000000eull,
+    0x000000000000000cull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000003ull, 0x000000000000000eull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x000000000000000cull,
+    0x0000000000000007ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x00000000000001ceull,
+    0x00000000000001feull, 0x0000000000000078ull, 0x0000000000000333ull,
+    0x00000000000001feull, 0x0000000000000078ull, 0x0000000000000078ull,
+    0x00000000000000fcull, 0x0000000000000186ull, 0x00000000000001ceull,
+    0x00000000000001feull, 0x0000000000000078ull, 0x0000000000000333ull,
+    0x00000000000001feull, 0x0000000000000078ull, 0x0000000000000078ull,
+    0x00000000000000fcull, 0x0000000000000186ull, 0x0000000000000000ull,
+    0x000000000000000cull, 0x00000000000001deull, 0x00000000000007ffull,
+    0x0000000000000bfeull, 0x00000000000013f8ull, 0x00000000000003ffull,
+    0x00000000000006e0ull, 0x0000000000000c00ull, 0x0000000000000000ull,
+    0x0000000000000600ull, 0x0000000000000f70ull, 0x0000000000001ffcull,
+    0x0000000000000ffaull, 0x00000000000003f9ull, 0x0000000000001ff8ull,
+    0x00000000000000ecull, 0x0000000000000006ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00000000000031ccull, 0x0000000000004bfeull,
+    0x00000000000007ffull, 0x00000000000037feull, 0x0000000000001ff8ull,
+    0x00000000000001ccull, 0x0000000000000006ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00000000000019c6ull, 0x0000000000003fe9ull,
+    0x0000000000007ff0ull, 0x0000000000003ff6ull, 0x0000000000000ffcull,
+    0x00000000000019c0ull, 0x0000000000003000ull, 0x00000000000007f0ull,
+    0x0000000000001ffcull, 0x0000000000003ffeull, 0x0000000000007fffull,
+    0x0000000000007fffull, 0x0000000000007fffull, 0x0000000000003ffeull,
+    0x0000000000000ff8ull, 0x00000000000007f0ull, 0x0000000000001ffcull,
+    0x0000000000003ffeull, 0x0000000000007fffull, 0x0000000000007fffull,
+    0x0000000000007fffull, 0x0000000000003ffeull, 0x0000000000000ff8ull,
+    0x00000000000007f0ull, 0x0000000000001ffcull, 0x0000000000003ffeull,
+    0x0000000000007fffull, 0x0000000000007fffull, 0x0000000000007fffull,
+    0x0000000000003ffeull, 0x0000000000000ff8ull, 0x00000000000007f0ull,
+    0x0000000000001ffcull, 0x0000000000003ffeull, 0x0000000000007fffull,
+    0x0000000000007fffull, 0x0000000000007fffull, 0x0000000000003ffeull,
+    0x0000000000000ff8ull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x000000ffffffffffull, 0x000000ffffffffffull,
+    0x000000ffffffffffull, 0x0000018ef1c007c0ull, 0x000071cff1e1cfceull,
+    0x000078fff8ffdfefull, 0x0000787ffbffffe7ull, 0x0000787cffffffefull,
+    0x000038fcffe7effeull, 0x000019fc3fe7efdcull, 0x00001dfc7be3ce1full,
+    0x00001c0073c00c0full, 0x00001c0000000000ull, 0x000001f001c7b8c0ull,
+    0x000039f9c3c7f9c7ull, 0x00007bfdff8fff8full, 0x000073ffffefff0full,
+    0x00007bffffff9f0full, 0x00003ffbf3ff9f8eull, 0x00001dfbf3fe1fccull,
+    0x00007c39e3ef1fdcull, 0x0000781801e7001cull, 0x000000000000001cull,
+    0x0000000000000000ull, 0x000000000600000full, 0x0000000007f800ffull,
+    0x0000000007ffffffull, 0x0000000007ffffffull, 0x0000000007ffffffull,
+    0x0000000007ffffffull, 0x0000000007ffffffull, 0x0000000007ffffffull,
+    0x0000000007ffffffull, 0x0000000003ffffffull, 0x0000000001fffffcull,
+    0x00000000007ffff0ull, 0x000000000007ff00ull, 0x0000000000000000ull,
+    0x0000000007800003ull, 0x0000000007f800ffull, 0x0000000007ffffffull,
+    0x0000000007ffffffull, 0x0000000007ffffffull, 0x0000000007ffffffull,
+    0x0000000007ffffffull, 0x0000000007ffffffull, 0x0000000007ffffffull,
+    0x0000000007fffffeull, 0x0000000001fffffcull, 0x00000000007ffff0ull,
+    0x000000000007ff00ull, 0x0000000000780000ull, 0x0000000000fc0000ull,
+    0x0000000001fe0000ull, 0x0000000001fffe00ull, 0x0000000001ffff00ull,
+    0x0000000007fffff0ull, 0x000000001ffffffcull, 0x000000003ffffffeull,
+    0x000000003fffffffull, 0x000000003fffffffull, 0x000000001fffffffull,
+    0x0000000007ffffffull, 0x0000000000000780ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x00000000001fffe0ull, 0x00000000003fffe0ull,
+    0x0000000003fffff8ull, 0x000000000ffffffeull, 0x000000001fffffffull,
+    0x000000003fffffffull, 0x000000003fffffffull, 0x000000003ffffffeull,
+    0x000000003ffffff8ull, 0x00000000000008c0ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c0ull, 0x0000000000000feeull,
+    0x0000000000001ffbull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x00000000000000c4ull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000000f8ull, 0x0000000000001dfcull,
+    0x00000000000037feull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x0000000000000c40ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c6ull, 0x0000000000000fe3ull,
+    0x0000000000001ffeull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x000000000000008cull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000018f8ull, 0x00000000000031fcull,
+    0x0000000000001ffeull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x0000000000000cc0ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c0ull, 0x0000000000000feeull,
+    0x0000000000001ffbull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x00000000000000ccull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000000f8ull, 0x0000000000001dfcull,
+    0x00000000000037feull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x00000000000008c0ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c0ull, 0x0000000000000feeull,
+    0x0000000000001ffbull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x00000000000000c4ull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000000f8ull, 0x0000000000001dfcull,
+    0x00000000000037feull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x0000000000000c40ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c6ull, 0x0000000000000fe3ull,
+    0x0000000000001ffeull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x000000000000008cull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000018f8ull, 0x00000000000031fcull,
+    0x0000000000001ffeull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x00000000000008c0ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c6ull, 0x0000000000000fe3ull,
+    0x0000000000001ffeull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x00000000000000c4ull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000018f8ull, 0x00000000000031fcull,
+    0x0000000000001ffeull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x0000000000000c40ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c0ull, 0x0000000000000fe3ull,
+    0x0000000000001ff6ull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x000000000000008cull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000000f8ull, 0x00000000000031fcull,
+    0x0000000000001bfeull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x00000000000008c0ull, 0x0000000000000fc0ull,
+    0x0000000000001fe0ull, 0x0000000000003ff0ull, 0x0000000000001fe0ull,
+    0x0000000000000780ull, 0x00000000000007c0ull, 0x0000000000000fe3ull,
+    0x0000000000001ff6ull, 0x0000000000001ff8ull, 0x0000000000001ff0ull,
+    0x00000000000037b8ull, 0x00000000000000c4ull, 0x00000000000000fcull,
+    0x00000000000001feull, 0x00000000000003ffull, 0x00000000000001feull,
+    0x0000000000000078ull, 0x00000000000000f8ull, 0x00000000000031fcull,
+    0x0000000000001bfeull, 0x00000000000007feull, 0x00000000000003feull,
+    0x000000000000077bull, 0x0000000000000004ull, 0x0000000000080003ull,
+    0x00000000003c0001ull, 0x00000000007e7c03ull, 0x0000000000ffff8eull,
+    0x00000000007ffffcull, 0x00000000003feff0ull, 0x00000000000f03e0ull,
+    0x00000000001b01b0ull, 0x00000000001981b0ull, 0x0000000000300360ull,
+    0x0000000000200000ull, 0x0000000000c00010ull, 0x000000000080003cull,
+    0x0000000000c03e7eull, 0x000000000071ffffull, 0x00000000003ffffeull,
+    0x00000000000ff7fcull, 0x000000000007c0f0ull, 0x00000000000d80d8ull,
+    0x00000000000d8198ull, 0x000000000006c00cull, 0x0000000000000000ull,
+    0x0000000000080001ull, 0x00000000003c0007ull, 0x00000000007e780cull,
+    0x0000000000ffff98ull, 0x00000000007ffff0ull, 0x00000000003ffff0ull,
+    0x000000000007ffc0ull, 0x0000000000038780ull, 0x0000000000018180ull,
+    0x0000000000030300ull, 0x0000000000000000ull, 0x0000000000800010ull,
+    0x0000000000e0003cull, 0x0000000000301e7eull, 0x000000000019ffffull,
+    0x00000000000ffffeull, 0x00000000000ffffcull, 0x000000000003ffe0ull,
+    0x000000000001e1c0ull, 0x0000000000018180ull, 0x000000000000c0c0ull,
+    0x0000000000010003ull, 0x0000000000078004ull, 0x00000000000fc006ull,
+    0x00000000001fc7e3ull, 0x00000000000ffffeull, 0x000000000007fffcull,
+    0x000000000003fff0ull, 0x000000000001fbd8ull, 0x000000000003b19cull,
+    0x000000000003318cull, 0x0000000000021b06ull, 0x0000000000180010ull,
+    0x000000000004003cull, 0x00000000000c007eull, 0x000000000018fc7full,
+    0x00000000000ffffeull, 0x000000000007fffcull, 0x000000000001fff8ull,
+    0x0000000000037bf0ull, 0x00000000000731b8ull, 0x0000000000063198ull,
+    0x00000000000c1b08ull, 0x0000000000040000ull, 0x00000000001e000eull,
+    0x00000000003f001bull, 0x00000000007f1f30ull, 0x00000000003ffff0ull,
+    0x00000000001fffe0ull, 0x00000000000fffe0ull, 0x000000000007dfe0ull,
+    0x00000000000d8770ull, 0x0000000000098630ull, 0x0000000000008420ull,
+    0x0000000000000010ull, 0x000000000038003cull, 0x00000000006c007eull,
+    0x0000000000067c7full, 0x000000000007fffeull, 0x000000000003fffcull,
+    0x000000000003fff8ull, 0x000000000003fdf0ull, 0x00000000000770d8ull,
+    0x00000000000630c8ull, 0x0000000000021080ull, 0x0000000000003100ull,
+    0x0000000000003f80ull, 0x0000000000007fc0ull, 0x0000000000033fc0ull,
+    0x0000000000018f00ull, 0x000000000000ffb0ull, 0x0000000000007fe0ull,
+    0x0000000000003f00ull, 0x0000000000001f80ull, 0x0000000000003fc0ull,
+    0x0000000000003ff7ull, 0x0000000000007fdcull, 0x000000000000c380ull,
+    0x0000000000000600ull, 0x0000000000000230ull, 0x00000000000007f0ull,
+    0x0000000000000ff8ull, 0x0000000000000ff3ull, 0x00000000000003c6ull,
+    0x00000000000037fcull, 0x0000000000001ff8ull, 0x00000000000003f0ull,
+    0x00000000000007e0ull, 0x0000000000000ff0ull, 0x000000000003bff0ull,
+    0x000000000000eff8ull, 0x000000000000070cull, 0x0000000000000180ull,
+    0x0000000000006600ull, 0x0000000000007f00ull, 0x000000000000ff80ull,
+    0x0000000000007f80ull, 0x0000000000031e30ull, 0x000000000001ffe0ull,
+    0x0000000000007f80ull, 0x0000000000001fdeull, 0x0000000000001ff3ull,
+    0x0000000000003fe0ull, 0x0000000000003fe0ull, 0x00000000000070f0ull,
+    0x000000000000c038ull, 0x0000000000000000ull, 0x0000000000000198ull,
+    0x00000000000003f8ull, 0x00000000000007fcull, 0x00000000000007f8ull,
+    0x00000000000031e3ull, 0x0000000000001ffeull, 0x00000000000007f8ull,
+    0x000000000001efe0ull, 0x0000000000033fe0ull, 0x0000000000001ff0ull,
+    0x0000000000001ff0ull, 0x0000000000003c38ull, 0x000000000000700cull,
+    0x0000000000000000ull, 0x0000000000003000ull, 0x0000000000001800ull,
+    0x0000000000003330ull, 0x0000000000001bf0ull, 0x0000000000003ff8ull,
+    0x0000000000003ffcull, 0x0000000000007ff8ull, 0x000000000000efe0ull,
+    0x000000000001c7f0ull, 0x0000000000030ff8ull, 0x0000000000001decull,
+    0x0000000000003006ull, 0x0000000000006003ull, 0x0000000000000000ull,
+    0x0000000000000030ull, 0x0000000000000060ull, 0x0000000000003330ull,
+    0x0000000000003f60ull, 0x0000000000007ff0ull, 0x000000000000fff0ull,
+    0x0000000000007ff8ull, 0x0000000000001fdcull, 0x0000000000003f8eull,
+    0x0000000000007fc3ull, 0x000000000000dee0ull, 0x0000000000018030ull,
+    0x0000000000030018ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x000000000008c000ull, 0x00000000000fe000ull,
+    0x00000000001ff000ull, 0x00000000000fe000ull, 0x000000000003fc00ull,
+    0x00000000000fff00ull, 0x00000000003bff87ull, 0x000000000001ffb8ull,
+    0x000000000003fee0ull, 0x0000000000061c00ull, 0x0000000000003000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x00000000000000c4ull, 0x00000000000001fcull, 0x00000000000003feull,
+    0x00000000000001fcull, 0x0000000000000ff0ull, 0x0000000000003ffcull,
+    0x0000000000387ff7ull, 0x0000000000077fe0ull, 0x000000000001dff0ull,
+    0x0000000000000e18ull, 0x0000000000000300ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x000000000008c000ull, 0x00000000000fe000ull,
+    0x00000000001ff000ull, 0x00000000000fe000ull, 0x000000000003fc00ull,
+    0x00000000000fff00ull, 0x00000000003bff87ull, 0x0000000000070ffdull,
+    0x00000000000c0ff0ull, 0x00000000000003d8ull, 0x00000000000000c0ull,
+    0x0000000000000060ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x00000000000000c4ull, 0x00000000000001fcull, 0x00000000000003feull,
+    0x00000000000001fcull, 0x0000000000000ff0ull, 0x0000000000003ffcull,
+    0x0000000000387ff7ull, 0x00000000002ffc38ull, 0x000000000003fc0cull,
+    0x000000000006f000ull, 0x000000000000c000ull, 0x0000000000018000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x00000000000000c4ull,
+    0x00000000000001fcull, 0x00000000000003feull, 0x00000000000001fcull,
+    0x0000000000000ff0ull, 0x0000000000003ffcull, 0x0000000000387ff7ull,
+    0x00000000006ffc38ull, 0x000000000003fc0cull, 0x000000000006f000ull,
+    0x000000000000c000ull, 0x0000000000018000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000118000ull, 0x00000000001fc000ull,
+    0x00000000003fe000ull, 0x00000000001fc000ull, 0x000000000007f800ull,
+    0x00000000001ffe00ull, 0x000000000077ff0eull, 0x00000000000e1ffbull,
+    0x0000000000181fe0ull, 0x00000000000007b0ull, 0x0000000000000180ull,
+    0x00000000000000c0ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000070000ull,
+    0x00000000001de066ull, 0x0000000000f3f9feull, 0x000000000007ffffull,
+    0x000000000007fffeull, 0x00000000001ffff0ull, 0x00000000001f1ff8ull,
+    0x000000000070038eull, 0x00000000000001c0ull, 0x0000000000000070ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x00000000000000e0ull, 0x00000000006607b8ull,
+    0x00000000007f9fcfull, 0x0000000000ffffe0ull, 0x00000000007fffe0ull,
+    0x00000000000ffff8ull, 0x00000000001ff8f8ull, 0x000000000071c00eull,
+    0x0000000000038000ull, 0x00000000000e0000ull, 0x0000000000000000ull,
+    0x00000000000f8000ull, 0x00000000003fe1e0ull, 0x00000000063ff3f0ull,
+    0x000000000f7ffffeull, 0x000000000fffffffull, 0x000000001fffffffull,
+    0x000000007ffffffeull, 0x000000006ffffffcull, 0x00000000dffffff4ull,
+    0x000000009ffffff0ull, 0x00000000cffffdf0ull, 0x0000000047bff0f0ull,
+    0x000000000781e060ull, 0x0000000003c38000ull, 0x0000000000c30000ull,
+    0x000000000001f000ull, 0x000000000787fc00ull, 0x000000000fcffc60ull,
+    0x000000007ffffef0ull, 0x00000000fffffff0ull, 0x00000000fffffff8ull,
+    0x000000007ffffffeull, 0x000000003ffffff6ull, 0x000000002ffffffbull,
+    0x000000000ffffff9ull, 0x000000000fbffff3ull, 0x000000000f0ffde2ull,
+    0x00000000060781e0ull, 0x000000000001c3c0ull, 0x000000000000c300ull,
+    0x00000000000f8000ull, 0x00000000003fe000ull, 0x00000000663ff1e0ull,
+    0x00000000cf7ffbf8ull, 0x000000008ffffff8ull, 0x00000000dffffffeull,
+    0x000000007fffffffull, 0x000000001fffffffull, 0x000000001ffffffeull,
+    0x000000003fffffffull, 0x000000003c7ffbffull, 0x000000007807f1b6ull,
+    0x00000000e0003c30ull, 0x00000000c0000f00ull, 0x0000000000000600ull,
+    0x000000000001f000ull, 0x000000000007fc00ull, 0x00000000078ffc66ull,
+    0x000000001fdffef3ull, 0x000000001ffffff1ull, 0x000000007ffffffbull,
+    0x00000000fffffffeull, 0x00000000fffffff8ull, 0x000000007ffffff8ull,
+    0x00000000fffffffcull, 0x00000000ffdffe3cull, 0x000000006d8fe01eull,
+    0x000000000c3c0007ull, 0x0000000000f00003ull, 0x0000000000600000ull,
+    0x0000000000030000ull, 0x00000000c00ff00cull, 0x00000000030fff0cull,
+    0x000000003ffffffcull, 0x000000003ffffffcull, 0x000000003fffffffull,
+    0x00000000ffffffffull, 0x00000000ffffffffull, 0x000000003fffffffull,
+    0x000000003fffffffull, 0x00000000cffffffcull, 0x000000000ffffffcull,
+    0x000000000ffffffcull, 0x0000000003fffff0ull, 0x0000000000cff0c0ull,
+    0x000000000000c000ull, 0x00000000300ff003ull, 0x0000000030fff0c0ull,
+    0x000000003ffffffcull, 0x000000003ffffffcull, 0x00000000fffffffcull,
+    0x00000000ffffffffull, 0x00000000ffffffffull, 0x00000000fffffffcull,
+    0x00000000fffffffcull, 0x000000003ffffff3ull, 0x000000003ffffff0ull,
+    0x000000003ffffff0ull, 0x000000000fffffc0ull, 0x00000000030ff300ull,
+    0x0000000007000000ull, 0x000000000c0ff000ull, 0x000000000bffffc0ull,
+    0x000000000ffffffaull, 0x000000003ffffffcull, 0x000000003ffffff0ull,
+    0x00000000fffffffcull, 0x00000000ffffffffull, 0x00000000ffffffffull,
+    0x00000000fffffffcull, 0x00000000fffffffcull, 0x000000003ffffff0ull,
+    0x000000003ffffff0ull, 0x000000000ffffff0ull, 0x00000000000cf000ull,
+    0x00000000000000e0ull, 0x00000000000ff030ull, 0x0000000003ffffd0ull,
+    0x000000005ffffff0ull, 0x000000003ffffffcull, 0x000000000ffffffcull,
+    0x000000003fffffffull, 0x00000000ffffffffull, 0x00000000ffffffffull,
+    0x000000003fffffffull, 0x000000003fffffffull, 0x000000000ffffffcull,
+    0x000000000ffffffcull, 0x000000000ffffff0ull, 0x00000000000f3000ull,
+    0x0000000000000000ull, 0x00000000000ff030ull, 0x000000000ffff0e0ull,
+    0x000000003fffe0f0ull, 0x000000003ffff0fcull, 0x000000003ffffb0cull,
+    0x00000000fffffe0full, 0x00000000ffffff03ull, 0x00000000ffffffc3ull,
+    0x000000007fffffccull, 0x0000000003ffff00ull, 0x0000000030ffffc0ull,
+    0x00000000fc0ff000ull, 0x000000003f00000cull, 0x0000000000030c03ull,
+    0x0000000000000000ull, 0x000000000c0ff000ull, 0x00000000070ffff0ull,
+    0x000000000f07fffcull, 0x000000003f0ffffcull, 0x0000000030dffffcull,
+    0x00000000f07fffffull, 0x00000000c0ffffffull, 0x00000000c3ffffffull,
+    0x0000000033fffffeull, 0x0000000000ffffc0ull, 0x0000000003ffff0cull,
+    0x00000000000ff03full, 0x00000000300000fcull, 0x00000000c030c000ull,
+    0x000000000000003cull, 0x000000000000003cull, 0x000000000000003cull,
+    0x000000000000003cull, 0x000000000000003cull, 0x000000000000003eull,
+    0x000000000000003full, 0x0000000000000007ull, 0x000000000000000full,
+    0x000000000000000full, 0x000000000000000full, 0x000000000000000full,
+    0x000000000000000full, 0x000000000000001full, 0x000000000000003full,
+    0x0000000000000038ull, 0x000000000000000full, 0x000000000000000full,
+    0x000000000000000full, 0x000000000000000full, 0x000000000000000full,
+    0x000000000000001full, 0x000000000000003full, 0x0000000000000038ull,
+    0x000000000000003cull, 0x000000000000003cull, 0x000000000000003cull,
+    0x000000000000003cull, 0x000000000000003cull, 0x000000000000003eull,
+    0x000000000000003full, 0x0000000000000007ull, 0x0000000000000c03ull,
+    0x0000000000000f0full, 0x0000000000000f0full, 0x0000000000000f9full,
+    0x00000000000003fcull, 0x00000000000003fcull, 0x00000000000000f0ull,
+    0x0000000000000c03ull, 0x0000000000000f0full, 0x0000000000000f0full,
+    0x0000000000000f9full, 0x00000000000003fcull, 0x00000000000003fcull,
+    0x00000000000000f0ull, 0x000000000000300cull, 0x000000000000fc0full,
+    0x000000000000fc1full, 0x000000000000ff3full, 0x000000000000cff3ull,
+    0x000000000000cff3ull, 0x0000000000000ff0ull, 0x0000000000000ff0ull,
+    0x0000000000000ff0ull, 0x0000000000000ff0ull, 0x0000000000001ff0ull,
+    0x0000000000001ff0ull, 0x0000000000003df8ull, 0x0000000000003c78ull,
+    0x000000000000301cull, 0x0000000000001800ull, 0x000000000000300cull,
+    0x000000000000f03full, 0x000000000000f83full, 0x000000000000fcffull,
+    0x000000000000cff3ull, 0x000000000000cff3ull, 0x0000000000000ff0ull,
+    0x0000000000000ff0ull, 0x0000000000000ff0ull, 0x0000000000000ff0ull,
+    0x0000000000000ff8ull, 0x0000000000000ff8ull, 0x0000000000001fbcull,
+    0x0000000000001e3cull, 0x000000000000380cull, 0x0000000000000018ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030303030000ull,
+    0x0000030300000303ull, 0x0303000000000000ull, 0x0100000001010100ull,
+    0x0000010101000001ull, 0x0000000000010101ull, 0x0101010100000000ull,
+    0x0000010101000001ull, 0x0303030303030000ull, 0x0303030300000303ull,
+    0x0303030300000000ull, 0x0100000101000101ull, 0x0101010101010001ull,
+    0x0000000001010101ull, 0x0000010100010100ull, 0x0000000101010001ull,
+    0x0303030303030000ull, 0x0303030300000303ull, 0x0303030300000000ull,
+    0x0100000100000101ull, 0x0101010000000001ull, 0x0001010001010001ull,
+    0x0000010100010100ull, 0x0000000001010000ull, 0x0303030303030000ull,
+    0x0303030300000303ull, 0x0303030303000003ull, 0x0100010100000101ull,
+    0x0000010101000001ull, 0x0001010001010000ull, 0x0101010101010101ull,
+    0x0000010101010100ull, 0x0303030303030000ull, 0x0303000000000303ull,
+    0x0000030303030303ull, 0x0101010000010100ull, 0x0000000101010101ull,
+    0x0101010101010100ull, 0x0101000000010101ull, 0x0001010101010101ull,
+    0x0303030303030300ull, 0x0303000000030303ull, 0x0000030303030303ull,
+    0x0001010000010100ull, 0x0000000001010101ull, 0x0101000101000000ull,
+    0x0100000000010100ull, 0x0001010000010101ull, 0x0303030303030303ull,
+    0x0000000003030303ull, 0x0000000003030303ull, 0x0001010101010000ull,
+    0x0000010101010101ull, 0x0000000101000101ull, 0x0100010100010100ull,
+    0x0001010101010101ull, 0x0000000000030303ull, 0x0000000003030300ull,
+    0x0000000000000000ull, 0x0000010101000000ull, 0x0001010101010101ull,
+    0x0000000001010100ull, 0x0101010000010100ull, 0x0000000101010000ull,
+    0x0000000003030000ull, 0x0000030300000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010000000000ull,
+    0x0000010101000001ull, 0x0000000001010101ull, 0x0000000003030303ull,
+    0x0303030303030000ull, 0x0000000001040401ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101010100ull, 0x0101010001010001ull,
+    0x0000000101010101ull, 0x0000000303030303ull, 0x0303030303030000ull,
+    0x0101010104040101ull, 0x0000000000000000ull, 0x0401010101000000ull,
+    0x0100000101010404ull, 0x0101010001010001ull, 0x0000010101000001ull,
+    0x0000030303030303ull, 0x0303030303030303ull, 0x0404040401010401ull,
+    0x0101010101010101ull, 0x0404040404010101ull, 0x0100000000010401ull,
+    0x0100010101000001ull, 0x0000010101010101ull, 0x0303030300000303ull,
+    0x0303000003030303ull, 0x0101010102030401ull, 0x0404040404040404ull,
+    0x0201010101040404ull, 0x0101000000010403ull, 0x0000000101010001ull,
+    0x0000010100010101ull, 0x0301030300000303ull, 0x0303000003030303ull,
+    0x0302030203020401ull, 0x0101010101010101ull, 0x0302030203010101ull,
+    0x0101000000010402ull, 0x0000010100010100ull, 0x0000010100000000ull,
+    0x0303030300000000ull, 0x0000000003030303ull, 0x0203020302030401ull,
+    0x0203020302030203ull, 0x0203020302030203ull, 0x0101000000010403ull,
+    0x0000010100010100ull, 0x0000000101010000ull, 0x0301030300000000ull,
+    0x0000000003030303ull, 0x0302030203020401ull, 0x0302030203020302ull,
+    0x0302030203020302ull, 0x0101000000010402ull, 0x0000000101010000ull,
+    0x0000000001010000ull, 0x0303030300000000ull, 0x0000000003030303ull,
+    0x0203020302010401ull, 0x0203020302030203ull, 0x0203020302030203ull,
+    0x0000000000010401ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0301030300000000ull, 0x0000000003030303ull, 0x0302030201040401ull,
+    0x0302030203020302ull, 0x0102030203020302ull, 0x0000000000010404ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030300000000ull,
+    0x0000000303030303ull, 0x0101010104040101ull, 0x0203020302030203ull,
+    0x0401010101030203ull, 0x0000000000000104ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0301030300000000ull, 0x0000000303030303ull,
+    0x0404040401010000ull, 0x0101010101010101ull, 0x0104040404010101ull,
+    0x0000000000000001ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030303000000ull, 0x0000030303030003ull, 0x0101010100000000ull,
+    0x0404040404040404ull, 0x0001010101040404ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0003030303000000ull,
+    0x0000030303030000ull, 0x0000000000000000ull, 0x0101010101010101ull,
+    0x0000000000010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000303030000ull, 0x0000030300000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000303000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0002020202000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000010000000101ull, 0x0001000000000000ull,
+    0x0000000001010000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0204040404020000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000010101010101ull, 0x0101000000000000ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0404020204020200ull,
+    0x0101000000000002ull, 0x0100000000000000ull, 0x0001040101010401ull,
+    0x0104010000000000ull, 0x0000000101040101ull, 0x0000000000000000ull,
+    0x0101010101010100ull, 0x0402030302040202ull, 0x0100000000000002ull,
+    0x0101000000000101ull, 0x0101010101010101ull, 0x0101010100000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0204040404040101ull,
+    0x0402010101020402ull, 0x0000000000000002ull, 0x0100000000000000ull,
+    0x0001010101010101ull, 0x0101010000000000ull, 0x0000000101010101ull,
+    0x0101010100000000ull, 0x0404040404040401ull, 0x0402040404020404ull,
+    0x0000000000010102ull, 0x0000000000000000ull, 0x0000000101010100ull,
+    0x0100000000000000ull, 0x0000000000010101ull, 0x0404040401010000ull,
+    0x0404040401010101ull, 0x0404020404040404ull, 0x0000000101040402ull,
+    0x0000000000000000ull, 0x0000000101010101ull, 0x0101000000010100ull,
+    0x0000000000010101ull, 0x0201020104040100ull, 0x0101010101020201ull,
+    0x0404040404040404ull, 0x0000010404040404ull, 0x0100010101000000ull,
+    0x0000010101010101ull, 0x0101010000000101ull, 0x0000000001010101ull,
+    0x0102010101040401ull, 0x0102010201020102ull, 0x0401010101010101ull,
+    0x0000010404040404ull, 0x0101010001010000ull, 0x0001010101010101ull,
+    0x0101010101010100ull, 0x0000000101010101ull, 0x0201010101010401ull,
+    0x0201020102010201ull, 0x0101020102010201ull, 0x0000010101010101ull,
+    0x0101010000000000ull, 0x0001010101010101ull, 0x0101010101000000ull,
+    0x0000000101010101ull, 0x0101010101040401ull, 0x0102010201020101ull,
+    0x0102010201020102ull, 0x0000000101010102ull, 0x0101000000000000ull,
+    0x0001010101010101ull, 0x0101010100000000ull, 0x0000000101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0000000000010101ull, 0x0101010000000000ull, 0x0101000101010100ull,
+    0x0100010101000000ull, 0x0000010100010101ull, 0x0303030301040404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404040103030303ull, 0x0101000000000000ull, 0x0100000001010000ull,
+    0x0001010100000101ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0101000000000000ull, 0x0100000001010101ull, 0x0001010101010101ull,
+    0x0303030301020404ull, 0x0303040403030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404020103030303ull, 0x0101010000000000ull,
+    0x0000000101010101ull, 0x0000000101010100ull, 0x0303030301040204ull,
+    0x0303030304040303ull, 0x0303030303030404ull, 0x0303030404030303ull,
+    0x0402040103030303ull, 0x0101010100000000ull, 0x0101010101010101ull,
+    0x0101000001010000ull, 0x0303030301020404ull, 0x0404030303030404ull,
+    0x0303030303030303ull, 0x0303030303040403ull, 0x0404020103030303ull,
+    0x0101010000000000ull, 0x0100000101010101ull, 0x0001010101010101ull,
+    0x0303030301040204ull, 0x0303030303030404ull, 0x0403030303030303ull,
+    0x0303030303030304ull, 0x0402040103030303ull, 0x0100000000000000ull,
+    0x0000000000010101ull, 0x0000000101010100ull, 0x0404030301020404ull,
+    0x0303030303030303ull, 0x0403030303030303ull, 0x0303030303030304ull,
+    0x0404020103030303ull, 0x0101000000000000ull, 0x0000000000010101ull,
+    0x0000000101010100ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0304040303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0101010001010100ull, 0x0000000001010101ull, 0x0000010101010101ull,
+    0x0303030301020404ull, 0x0404030303030303ull, 0x0303030303030303ull,
+    0x0404030303030303ull, 0x0404020103030303ull, 0x0101010101000101ull,
+    0x0100000101010101ull, 0x0001010000000001ull, 0x0303030301040204ull,
+    0x0303040403030303ull, 0x0303030303030303ull, 0x0303040303030303ull,
+    0x0402040103030303ull, 0x0101010101000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0303030304030303ull,
+    0x0303030303030303ull, 0x0303030304030303ull, 0x0404020103030303ull,
+    0x0101010100000000ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303040303ull, 0x0303030303030303ull,
+    0x0303030303040303ull, 0x0402040103030303ull, 0x0100010101000000ull,
+    0x0000010100010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030404ull,
+    0x0404020103030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404020103030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040404ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404040103030303ull,
+    0x0101000000000000ull, 0x0000000001000000ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0101000000000000ull,
+    0x0000000001010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0303040403030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404020103030303ull, 0x0401010000000000ull, 0x0000000104010101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030304040303ull,
+    0x0303030303030404ull, 0x0303030404030303ull, 0x0402040103030303ull,
+    0x0101010100000000ull, 0x0000010101010101ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0404030303030404ull, 0x0303030303030303ull,
+    0x0303030303040403ull, 0x0404020103030303ull, 0x0101010000000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030404ull, 0x0403030303030303ull, 0x0303030303030304ull,
+    0x0402040103030303ull, 0x0100000000000000ull, 0x0000000000010101ull,
+    0x0000000000000000ull, 0x0404030301020404ull, 0x0303030303030303ull,
+    0x0403030303030303ull, 0x0303030303030304ull, 0x0404020103030303ull,
+    0x0101000000000000ull, 0x0000000000010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0304040303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0101010001010100ull,
+    0x0000000001010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0404030303030303ull, 0x0303030303030303ull, 0x0404030303030303ull,
+    0x0404020103030303ull, 0x0101010101000101ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303040403030303ull,
+    0x0303030303030303ull, 0x0303040303030303ull, 0x0402040103030303ull,
+    0x0101010101000000ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0303030304030303ull, 0x0303030303030303ull,
+    0x0303030304030303ull, 0x0404020103030303ull, 0x0101010100000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303040303ull, 0x0303030303030303ull, 0x0303030303040303ull,
+    0x0402040103030303ull, 0x0100010101000000ull, 0x0000010100010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030404ull, 0x0404020103030303ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404020103030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040404ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404040103030303ull, 0x0001000000000000ull,
+    0x0000000001010000ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0402040103030303ull, 0x0101000000000000ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0303040403030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404020103030303ull,
+    0x0104010000000000ull, 0x0000000101040101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030304040303ull, 0x0303030303030404ull,
+    0x0303030404030303ull, 0x0402040103030303ull, 0x0101010100000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0404030303030404ull, 0x0303030303030303ull, 0x0303030303040403ull,
+    0x0404020103030303ull, 0x0101010000000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030404ull,
+    0x0403030303030303ull, 0x0303030303030304ull, 0x0402040103030303ull,
+    0x0100000000000000ull, 0x0000000000010101ull, 0x0000000000000000ull,
+    0x0404030301020404ull, 0x0303030303030303ull, 0x0403030303030303ull,
+    0x0303030303030304ull, 0x0404020103030303ull, 0x0101000000010100ull,
+    0x0000000000010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030303ull, 0x0304040303030303ull, 0x0303030303030303ull,
+    0x0402040103030303ull, 0x0101010000000101ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0404030303030303ull,
+    0x0303030303030303ull, 0x0404030303030303ull, 0x0404020103030303ull,
+    0x0101010101010100ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303040403030303ull, 0x0303030303030303ull,
+    0x0303040303030303ull, 0x0402040103030303ull, 0x0101010101000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0303030304030303ull, 0x0303030303030303ull, 0x0303030304030303ull,
+    0x0404020103030303ull, 0x0101010100000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0404040101010101ull,
+    0x0404040404040404ull, 0x0101010103010301ull, 0x0402040101010101ull,
+    0x0100010101000000ull, 0x0000010100010101ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0404010101010101ull, 0x0404040404040404ull,
+    0x0101010103030301ull, 0x0404020103010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0401010101010101ull, 0x0104040404040404ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0404010101010101ull,
+    0x0404040104040104ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030301040404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404040103030303ull, 0x0101000000000000ull, 0x0000000001000000ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0101000000000000ull, 0x0000000001010101ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0303040403030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404020103030303ull, 0x0401010000000000ull,
+    0x0000000104010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030304040303ull, 0x0303030303030404ull, 0x0303030404030303ull,
+    0x0402040103030303ull, 0x0101010100000000ull, 0x0000010101010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0404030303030404ull,
+    0x0303030303030303ull, 0x0303030303040403ull, 0x0404020103030303ull,
+    0x0101010000000000ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030404ull, 0x0403030303030303ull,
+    0x0303030303030304ull, 0x0402040103030303ull, 0x0100000000000000ull,
+    0x0000000000010101ull, 0x0000000000000000ull, 0x0404030301020404ull,
+    0x0303030303030303ull, 0x0403030303030303ull, 0x0303030303030304ull,
+    0x0404020103030303ull, 0x0101000000010100ull, 0x0000000000010101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0304040303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0101010000000101ull, 0x0000000001010101ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0404030303030303ull, 0x0303030303030303ull,
+    0x0404030303030303ull, 0x0404020103030303ull, 0x0101010101010100ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303040403030303ull, 0x0303030303030303ull, 0x0303040303030303ull,
+    0x0402040103030303ull, 0x0101010101000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0303030304030303ull,
+    0x0303030303030303ull, 0x0303030304030303ull, 0x0404020103030303ull,
+    0x0101010100000000ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0100010101000000ull,
+    0x0000010100010101ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040404ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404040103030303ull,
+    0x0001000000000000ull, 0x0000000001010000ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0101000000000000ull,
+    0x0000000001010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0303040403030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404020103030303ull, 0x0104010000000000ull, 0x0000000101040101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030304040303ull,
+    0x0303030303030404ull, 0x0303030404030303ull, 0x0402040103030303ull,
+    0x0101010100000000ull, 0x0000010101010101ull, 0x0000000000000000ull,
+    0x0303030301020404ull, 0x0404030303030404ull, 0x0303030303030303ull,
+    0x0303030303040403ull, 0x0404020103030303ull, 0x0101010000000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030404ull, 0x0403030303030303ull, 0x0303030303030304ull,
+    0x0402040103030303ull, 0x0100000000000000ull, 0x0000000000010101ull,
+    0x0000000000000000ull, 0x0404030301020404ull, 0x0303030303030303ull,
+    0x0403030303030303ull, 0x0303030303030304ull, 0x0404020103030303ull,
+    0x0101000000000000ull, 0x0000000000010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0304040303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0101010000000101ull,
+    0x0000000001010101ull, 0x0000000000000000ull, 0x0301030101020404ull,
+    0x0101010101010301ull, 0x0101040404040101ull, 0x0301030103030301ull,
+    0x0404020103010301ull, 0x0101010100010100ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0101030101040204ull, 0x0104010101010301ull,
+    0x0101040404040401ull, 0x0303030103010301ull, 0x0402040103010303ull,
+    0x0101010101000000ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101040101010101ull, 0x0104040404040404ull,
+    0x0103030103010301ull, 0x0404020103010303ull, 0x0101010100000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0404040101010101ull, 0x0404040404040404ull, 0x0101010103010301ull,
+    0x0402040101010101ull, 0x0100010101000000ull, 0x0000010100010101ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0404010101010101ull,
+    0x0404040404040404ull, 0x0101010103030301ull, 0x0404020103010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0401010101010101ull, 0x0104040404040404ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0404010101010101ull, 0x0404040104040104ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040404ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404040103030303ull, 0x0101000000000000ull,
+    0x0000000001000000ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0402040103030303ull, 0x0101000000000000ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0303030301020404ull, 0x0303040403030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404020103030303ull,
+    0x0401010000000000ull, 0x0000000104010101ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030304040303ull, 0x0303030303030404ull,
+    0x0303030404030303ull, 0x0402040103030303ull, 0x0101010100000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0303030301020404ull,
+    0x0404030303030404ull, 0x0303030303030303ull, 0x0303030303040403ull,
+    0x0404020103030303ull, 0x0101010000000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030404ull,
+    0x0403030303030303ull, 0x0303030303030304ull, 0x0402040103030303ull,
+    0x0100000000000000ull, 0x0000000000010101ull, 0x0000000000000000ull,
+    0x0404030301020404ull, 0x0303030303030303ull, 0x0403030303030303ull,
+    0x0303030303030304ull, 0x0404020103030303ull, 0x0101000000000000ull,
+    0x0000000000010101ull, 0x0000000000000000ull, 0x0303030301040204ull,
+    0x0303030303030303ull, 0x0304040303030303ull, 0x0303030303030303ull,
+    0x0402040103030303ull, 0x0101010000000101ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0101010100010100ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010101000000ull,
+    0x0000000101010101ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101010100000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0100010101000000ull, 0x0000010100010101ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030301040404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404040103030303ull, 0x0000000000010000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0000000000000101ull, 0x0000000000000000ull, 0x0000000001000000ull,
+    0x0303030301020404ull, 0x0303040403030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404020103030303ull, 0x0000000000000001ull,
+    0x0000000000000000ull, 0x0000010101010000ull, 0x0303030301040204ull,
+    0x0303030304040303ull, 0x0303030303030404ull, 0x0303030404030303ull,
+    0x0402040103030303ull, 0x0000000000000101ull, 0x0001010101010000ull,
+    0x0001040101010100ull, 0x0303030301020404ull, 0x0404030303030404ull,
+    0x0303030303030303ull, 0x0303030303040403ull, 0x0404020103030303ull,
+    0x0100000001010100ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0103030101040204ull, 0x0101010303010304ull, 0x0401040404010404ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010101010000ull,
+    0x0101010101010101ull, 0x0001010101010101ull, 0x0303030101020404ull,
+    0x0401010103010303ull, 0x0404040404040404ull, 0x0101030101010104ull,
+    0x0404020101010301ull, 0x0101010100000000ull, 0x0101010001010101ull,
+    0x0000010101010101ull, 0x0301030101040204ull, 0x0101030303010301ull,
+    0x0404040404040404ull, 0x0101030101010101ull, 0x0402040101010301ull,
+    0x0101010000000000ull, 0x0000000000000101ull, 0x0000000001010101ull,
+    0x0301030101020404ull, 0x0101010101010301ull, 0x0101040404040101ull,
+    0x0301030103030301ull, 0x0404020103010301ull, 0x0100010100000000ull,
+    0x0000000000000001ull, 0x0000000101000101ull, 0x0101030101040204ull,
+    0x0104010101010301ull, 0x0101040404040401ull, 0x0303030103010301ull,
+    0x0402040103010303ull, 0x0100010100000000ull, 0x0100000000000001ull,
+    0x0000000101000001ull, 0x0101010101020404ull, 0x0101040101010101ull,
+    0x0104040404040404ull, 0x0103030103010301ull, 0x0404020103010303ull,
+    0x0001010000000000ull, 0x0000000000000101ull, 0x0000010100000000ull,
+    0x0101010101040204ull, 0x0404040101010101ull, 0x0404040404040404ull,
+    0x0101010103010301ull, 0x0402040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0404010101010101ull, 0x0404040404040404ull, 0x0101010103030301ull,
+    0x0404020103010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0401010101010101ull,
+    0x0104040404040404ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0404010101010101ull, 0x0404040104040104ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040404ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404040103030303ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040204ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0402040103030303ull, 0x0000000000000001ull,
+    0x0000000000000000ull, 0x0000000001000000ull, 0x0303030301020404ull,
+    0x0303040403030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404020103030303ull, 0x0000000000010101ull, 0x0000000000000000ull,
+    0x0000010101010000ull, 0x0303030301040204ull, 0x0303030304040303ull,
+    0x0303030303030404ull, 0x0303030404030303ull, 0x0402040103030303ull,
+    0x0000000001010000ull, 0x0001010101000000ull, 0x0001040101010100ull,
+    0x0303030301020404ull, 0x0404030303030404ull, 0x0303030303030303ull,
+    0x0303030303040403ull, 0x0404020103030303ull, 0x0100000101000000ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0101010100000000ull, 0x0101010101010101ull,
+    0x0001010101010101ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0101010100000000ull, 0x0101010101010101ull, 0x0000010101010101ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101000000000000ull,
+    0x0101010101010101ull, 0x0000000000010101ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0100000000000000ull, 0x0100000000010101ull,
+    0x0000000000000101ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0100000000000000ull, 0x0100000000000001ull, 0x0000000000000001ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0000000000000101ull, 0x0000000000000101ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040404ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404040103030303ull, 0x0000000000000101ull,
+    0x0000000000000000ull, 0x0000000000000001ull, 0x0303030301040204ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0402040103030303ull, 0x0000000000010000ull, 0x0100000000000000ull,
+    0x0000000000010101ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000010100ull, 0x0101000000000000ull, 0x0000000001040101ull,
+    0x0101010101040204ull, 0x0101030303010101ull, 0x0104010101040401ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010000000101ull,
+    0x0101000000010101ull, 0x0000000101010101ull, 0x0101010101020404ull,
+    0x0101010103010101ull, 0x0104040404040401ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101010101010100ull, 0x0101010101010101ull,
+    0x0000000001010101ull, 0x0103030101040204ull, 0x0101010303010303ull,
+    0x0401040404010404ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0101010101010000ull, 0x0101010101010101ull, 0x0000000000010101ull,
+    0x0303030101020404ull, 0x0401010103010303ull, 0x0404040404040404ull,
+    0x0101030101010104ull, 0x0404020101010301ull, 0x0101010100000000ull,
+    0x0101010101010101ull, 0x0000000000000101ull, 0x0301030101040204ull,
+    0x0101030303010301ull, 0x0404040404040404ull, 0x0101030101010101ull,
+    0x0402040101010301ull, 0x0101000101000000ull, 0x0101010101000101ull,
+    0x0000000000000001ull, 0x0301030101020404ull, 0x0101010101010301ull,
+    0x0101040404040101ull, 0x0301030103030301ull, 0x0404020103010301ull,
+    0x0100000101010000ull, 0x0100010100000001ull, 0x0000000000000101ull,
+    0x0101030101040204ull, 0x0104010101010301ull, 0x0101040404040401ull,
+    0x0303030103010301ull, 0x0402040103010303ull, 0x0100000001010000ull,
+    0x0000010100000001ull, 0x0000000000000101ull, 0x0101010101020404ull,
+    0x0101040101010101ull, 0x0104040404040404ull, 0x0103030103010301ull,
+    0x0404020103010303ull, 0x0000000000010100ull, 0x0000000101000101ull,
+    0x0000000000000100ull, 0x0101010101040204ull, 0x0404040101010101ull,
+    0x0404040404040404ull, 0x0101010103010301ull, 0x0402040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0404010101010101ull, 0x0404040404040404ull,
+    0x0101010103030301ull, 0x0404020103010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0401010101010101ull, 0x0104040404040404ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0404010101010101ull,
+    0x0404040104040104ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0303030301040404ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0404040103030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000010000ull, 0x0303030301040204ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0402040103030303ull,
+    0x0000000001010100ull, 0x0000000000000000ull, 0x0000000101010100ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000101000101ull,
+    0x0000000000000000ull, 0x0000010401010101ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000010100000000ull, 0x0000000101010101ull,
+    0x0001010101010101ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0101010100000000ull, 0x0101010101010101ull, 0x0000010101010101ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010000000000ull,
+    0x0101010101010101ull, 0x0000000101010101ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101010000000000ull, 0x0101010101010101ull,
+    0x0000000001010101ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0101010000000000ull, 0x0101000101010101ull, 0x0000000000010101ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0001010100000000ull,
+    0x0100000000010101ull, 0x0000000001010001ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000010100000000ull, 0x0100000000010100ull,
+    0x0000000001000001ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000010000000000ull, 0x0100000000010000ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101040404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303030301040404ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0404040103030303ull,
+    0x0000000000000000ull, 0x0000010100000001ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0100000000000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101000000000000ull, 0x0001010101010101ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101030303010101ull,
+    0x0104010101040401ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0101000000000000ull, 0x0000010101010101ull, 0x0000000000000101ull,
+    0x0101010101020404ull, 0x0101010103010101ull, 0x0104040404040401ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000000ull,
+    0x0100000001010101ull, 0x0000000000000001ull, 0x0103030101040204ull,
+    0x0101010303010303ull, 0x0401040404010404ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0100010100000000ull, 0x0101010101010101ull,
+    0x0000000000000000ull, 0x0303030101020404ull, 0x0401010103010303ull,
+    0x0404040404040404ull, 0x0101030101010104ull, 0x0404020101010301ull,
+    0x0101010000000000ull, 0x0001010101010101ull, 0x0000000000000000ull,
+    0x0301030101040204ull, 0x0101030303010301ull, 0x0404040404040404ull,
+    0x0101030101010101ull, 0x0402040101010301ull, 0x0000000000000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0301030101020404ull,
+    0x0101010101010301ull, 0x0101040404040101ull, 0x0301030103030301ull,
+    0x0404020103010301ull, 0x0100000000000000ull, 0x0000000101010101ull,
+    0x0000000000000000ull, 0x0101030101040204ull, 0x0104010101010301ull,
+    0x0101040404040401ull, 0x0303030103010301ull, 0x0402040103010303ull,
+    0x0101000000000000ull, 0x0000010101010101ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101040101010101ull, 0x0104040404040404ull,
+    0x0103030103010301ull, 0x0404020103010303ull, 0x0101010100010101ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0404040101010101ull, 0x0404040404040404ull, 0x0101010103010301ull,
+    0x0402040101010101ull, 0x0101000101010000ull, 0x0001010101010101ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0404010101010101ull,
+    0x0404040404040404ull, 0x0101010103030301ull, 0x0404020103010101ull,
+    0x0100000000000000ull, 0x0101000000000101ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0401010101010101ull, 0x0104040404040404ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0000000000000000ull,
+    0x0000000000010100ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0404010101010101ull, 0x0404040104040104ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101040404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404040101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0303030301040404ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0404040103030303ull, 0x0000000000000000ull,
+    0x0000010100000000ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000101000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000010100000000ull, 0x0000010100000101ull, 0x0000000000000000ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010100000000ull,
+    0x0000000101000101ull, 0x0000000000000000ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101010401000000ull, 0x0000010101010104ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0101010101010000ull, 0x0000010101010101ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0101010101000000ull,
+    0x0001010101010101ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0101010000000000ull, 0x0101010001010101ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0101010100000000ull, 0x0101000000010101ull, 0x0000000000000001ull,
+    0x0101010101040204ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0402040101010101ull, 0x0101010101000000ull,
+    0x0000000001010101ull, 0x0000000000000101ull, 0x0101010101020404ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0404020101010101ull, 0x0101010001010000ull, 0x0000000101010001ull,
+    0x0000000000000000ull, 0x0101010101040204ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0402040101010101ull,
+    0x0000000000010100ull, 0x0000010100000000ull, 0x0000000000000000ull,
+    0x0101010101020404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404020101010101ull, 0x0000000000000101ull,
+    0x0001010000000000ull, 0x0000000000000000ull, 0x0101010101040204ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0402040101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101020404ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0101010101010101ull, 0x0404020101010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101040404ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0101010101010101ull, 0x0404040101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0003030303030303ull, 0x0300000000000000ull, 0x0000030303030303ull,
+    0x0000000000000000ull, 0x0000000001010000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0303000000000000ull, 0x0302020202020202ull,
+    0x0203030000000003ull, 0x0303020202020202ull, 0x0000000000000000ull,
+    0x0101000101010100ull, 0x0100000000000001ull, 0x0000010101000001ull,
+    0x0203030000010100ull, 0x0202040404040402ull, 0x0202030300000303ull,
+    0x0302020202020202ull, 0x0000000000000003ull, 0x0101010101010101ull,
+    0x0101000000010101ull, 0x0001010101010101ull, 0x0303030301000001ull,
+    0x0304040404040404ull, 0x0203030303030303ull, 0x0303020202020202ull,
+    0x0000000000000303ull, 0x0101010101010100ull, 0x0101010001000101ull,
+    0x0101010101010101ull, 0x0303030300000000ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0303030303030303ull, 0x0000000000000303ull,
+    0x0101010101000000ull, 0x0101000100000101ull, 0x0101010101010101ull,
+    0x0303030300010100ull, 0x0303030303030303ull, 0x0303030303030303ull,
+    0x0303030303030303ull, 0x0000000000000303ull, 0x0101010101010101ull,
+    0x0000000000000101ull, 0x0101010101010101ull, 0x0303030000000101ull,
+    0x0303030303030303ull, 0x0303030300000303ull, 0x0303030303030303ull,
+    0x0000000000000003ull, 0x0101010000000000ull, 0x0100000000010100ull,
+    0x0000010101000001ull, 0x0300000000000000ull, 0x0303030303030303ull,
+    0x0303000000000000ull, 0x0003030303030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101000001010000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0202000000000000ull,
+    0x0000000000020202ull, 0x0202000000000000ull, 0x0202020200000002ull,
+    0x0200000002020200ull, 0x0000000000000002ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0402000002020200ull, 0x0202000002040404ull,
+    0x0402020000000002ull, 0x0404040200000004ull, 0x0402000004040202ull,
+    0x0002040200000002ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0402020004040202ull, 0x0402000204040204ull, 0x0404020202020204ull,
+    0x0402040202000000ull, 0x0204020204040204ull, 0x0002040402000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0404020000040402ull,
+    0x0402020404020202ull, 0x0204040204040204ull, 0x0202040402000202ull,
+    0x0002040204020204ull, 0x0002040402000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0404020002040402ull, 0x0404020404020202ull,
+    0x0204040204040202ull, 0x0204040402020404ull, 0x0002040404020000ull,
+    0x0002040402000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0404020204040200ull, 0x0404020004020402ull, 0x0404020000040402ull,
+    0x0404020404020204ull, 0x0204040404020000ull, 0x0000020402000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0402000404020000ull,
+    0x0404020002040404ull, 0x0404020000040402ull, 0x0000020404020202ull,
+    0x0404020404020000ull, 0x0000000202000002ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000404020202ull, 0x0402000004040200ull,
+    0x0404020000000404ull, 0x0002040402000402ull, 0x0402020404020000ull,
+    0x0000000404020004ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000004040402ull, 0x0000000004020000ull, 0x0402000000000000ull,
+    0x0004040200000404ull, 0x0000000000000000ull, 0x0000000404020000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000202020000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0001010000010100ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0001010101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101000000000000ull, 0x0000000001000000ull, 0x0100000000000000ull,
+    0x0101010101010101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000010000000101ull, 0x0000000000000000ull, 0x0101010000000000ull,
+    0x0000000001010101ull, 0x0100000000000000ull, 0x0001010101010101ull,
+    0x0000000000000000ull, 0x0100000000000000ull, 0x0000010101010101ull,
+    0x0000000000000000ull, 0x0401010100000000ull, 0x0000000104010101ull,
+    0x0000010100000000ull, 0x0000000101010100ull, 0x0000000000000101ull,
+    0x0101000000000000ull, 0x0001040101010401ull, 0x0000000000000000ull,
+    0x0101010000000000ull, 0x0000000001010101ull, 0x0101010000000000ull,
+    0x0101010101010101ull, 0x0000000000000001ull, 0x0100000000000000ull,
+    0x0000010101010101ull, 0x0000000000000000ull, 0x0101010101010000ull,
+    0x0000000000000101ull, 0x0100000000000000ull, 0x0001010101010101ull,
+    0x0000000000000000ull, 0x0101010100000000ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0101010101010101ull, 0x0000000001010101ull,
+    0x0101000101010100ull, 0x0000000101010101ull, 0x0000000000000000ull,
+    0x0101010101010000ull, 0x0000010101010101ull, 0x0100000000010101ull,
+    0x0101010101010101ull, 0x0000010101000101ull, 0x0101010100000101ull,
+    0x0000000101010101ull, 0x0000000101010000ull, 0x0101010101010100ull,
+    0x0101010001010101ull, 0x0101010101010001ull, 0x0000000001010101ull,
+    0x0000000000010101ull, 0x0101010000000000ull, 0x0000010101010101ull,
+    0x0101010000000000ull, 0x0101010101010100ull, 0x0000000000010101ull,
+    0x0101010100000000ull, 0x0000000001010101ull, 0x0000000001010000ull,
+    0x0101010000000000ull, 0x0000010101010101ull, 0x0100000000000000ull,
+    0x0101010101000101ull, 0x0000000001010101ull, 0x0101000101000000ull,
+    0x0000000000000101ull, 0x0000000000000000ull, 0x0101010100000000ull,
+    0x0001010100000000ull, 0x0000000000000000ull, 0x0001010100000000ull,
+    0x0000000101000000ull, 0x0101000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000010101000000ull, 0x0101000000000000ull,
+    0x0000000000000000ull, 0x0101000000000000ull, 0x0000000000000000ull,
+    0x0001010000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101000000010000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010101010000ull, 0x0000000000000001ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0104010101040100ull,
+    0x0000000000000101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0100000000000000ull, 0x0000000000000101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010101010000ull, 0x0000000000000001ull,
+    0x0000000000000000ull, 0x0000010100000101ull, 0x0101010100000000ull,
+    0x0000000001010100ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101010100000000ull, 0x0000000001010101ull, 0x0000000000000000ull,
+    0x0101010101010101ull, 0x0101010101010000ull, 0x0001010101000001ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010101010000ull,
+    0x0000010101010101ull, 0x0100000000000000ull, 0x0101010401010104ull,
+    0x0101010101010101ull, 0x0000000000000101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010100010101ull, 0x0001010101010101ull,
+    0x0000010101000000ull, 0x0101010101010101ull, 0x0101010101010101ull,
+    0x0000000000000101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000010101000000ull, 0x0101010101010000ull, 0x0001010001010101ull,
+    0x0101010101000000ull, 0x0101010101010101ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000001010000ull,
+    0x0101010101010000ull, 0x0000000000000101ull, 0x0101010101010000ull,
+    0x0100000001010101ull, 0x0000000001010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0101010100000000ull,
+    0x0000000000010100ull, 0x0101000000010101ull, 0x0000000000000001ull,
+    0x0000010101000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101000000000000ull, 0x0000000000000000ull,
+    0x0101010000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0100000000000000ull, 0x0000000000000001ull, 0x0000010101000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0100000000000000ull, 0x0000000001010101ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0100000000000000ull,
+    0x0000000001010101ull, 0x0000000000000000ull, 0x0101010000000000ull,
+    0x0101010000000001ull, 0x0000010101010101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101010000000000ull, 0x0000010101010101ull,
+    0x0000000000000000ull, 0x0101010100000000ull, 0x0101010100000302ull,
+    0x0000010101010101ull, 0x0000000000010100ull, 0x0101010000000000ull,
+    0x0101010100000001ull, 0x0000010101010101ull, 0x0001010000010100ull,
+    0x0104040101010100ull, 0x0101010102030302ull, 0x0001010101010101ull,
+    0x0000000001010101ull, 0x0101010101000000ull, 0x0101010101000101ull,
+    0x0001010101010101ull, 0x0101000001010101ull, 0x0101010101010101ull,
+    0x0101010102030302ull, 0x0101010101010101ull, 0x0000000001010101ull,
+    0x0101010101000000ull, 0x0101010102030201ull, 0x0101010101010101ull,
+    0x0100000001010101ull, 0x0101010101010101ull, 0x0101010102030302ull,
+    0x0101010101010101ull, 0x0000000101010101ull, 0x0101040401010100ull,
+    0x0101010203030201ull, 0x0101010101010101ull, 0x0101000101010101ull,
+    0x0102010102010100ull, 0x0101010102030302ull, 0x0101010101010101ull,
+    0x0001010101010101ull, 0x0101010101010101ull, 0x0101010203030201ull,
+    0x0101010101010101ull, 0x0001010101010101ull, 0x0102010202010000ull,
+    0x0101010102030301ull, 0x0101010101010101ull, 0x0001010001010101ull,
+    0x0101010101010101ull, 0x0101010203030201ull, 0x0101010101010101ull,
+    0x0000000101010101ull, 0x0102020200010000ull, 0x0101010102030301ull,
+    0x0102010101010101ull, 0x0101000101010101ull, 0x0101010201010200ull,
+    0x0101010203030201ull, 0x0101010101010101ull, 0x0000000101010101ull,
+    0x0102020100000000ull, 0x0102010102030301ull, 0x0102010101010101ull,
+    0x0100000101010101ull, 0x0101010102010201ull, 0x0101010203030201ull,
+    0x0101010101010102ull, 0x0000010101010201ull, 0x0101010100000000ull,
+    0x0102010102030001ull, 0x0201010101010101ull, 0x0101000001010101ull,
+    0x0101010101010101ull, 0x0201010203000101ull, 0x0001010101010101ull,
+    0x0000010101020000ull, 0x0101010100000000ull, 0x0201010100000000ull,
+    0x0200010101010102ull, 0x0001000000010101ull, 0x0100010100010100ull,
+    0x0201010100000001ull, 0x0000000000010101ull, 0x0001010101000000ull,
+    0x0001010000000000ull, 0x0101010000000000ull, 0x0100000000000001ull,
+    0x0000000000010101ull, 0x0000010100000000ull, 0x0000010101010000ull,
+    0x0000000000000000ull, 0x0101010000000000ull, 0x0000000000000000ull,
+    0x0100000000000000ull, 0x0101000000000101ull, 0x0000000000000101ull,
+    0x0000000000000000ull, 0x0000000001010101ull, 0x0000000000000000ull,
+    0x0101000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0101000000000101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000010100ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000102ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000010201ull, 0x0000000001010000ull,
+    0x0202020200000000ull, 0x0000000001010101ull, 0x0101000000000000ull,
+    0x0000000000000000ull, 0x0202020200000000ull, 0x0000000002020202ull,
+    0x0000000001010000ull, 0x0000000001010000ull, 0x0202020202020202ull,
+    0x0000000002020202ull, 0x0000000000000202ull, 0x0202000000000000ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0000000002000101ull,
+    0x0202010102020000ull, 0x0202010101010202ull, 0x0202020202020202ull,
+    0x0000020202020101ull, 0x0202020202000100ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0000000002020202ull, 0x0202020202020000ull,
+    0x0202020202020101ull, 0x0202020202020101ull, 0x0000020201010202ull,
+    0x0202020201010000ull, 0x0202020202020202ull, 0x0101020202020101ull,
+    0x0000020202020202ull, 0x0101020202020202ull, 0x0202020202020202ull,
+    0x0202020201010202ull, 0x0000020201010202ull, 0x0202010100000000ull,
+    0x0202020201010202ull, 0x0202020201010202ull, 0x0000020202020101ull,
+    0x0202020202020202ull, 0x0202010102020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020000ull, 0x0202020202020101ull,
+    0x0202020202020202ull, 0x0202020202020101ull, 0x0202020202020202ull,
+    0x0202010102020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202010102020202ull, 0x0202020202020101ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0000020201010202ull, 0x0101020202020202ull,
+    0x0101020202020202ull, 0x0202020201010202ull, 0x0202020201010101ull,
+    0x0202020201010202ull, 0x0202020202020202ull, 0x0202020201010202ull,
+    0x0000010102020202ull, 0x0101020202020000ull, 0x0202010102020202ull,
+    0x0202020202020202ull, 0x0202010102020202ull, 0x0202010102020000ull,
+    0x0202020201010202ull, 0x0202020201010202ull, 0x0101000002020202ull,
+    0x0202020202020000ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020101ull, 0x0202020202020000ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0000000001010202ull, 0x0202020200000000ull,
+    0x0202020202020101ull, 0x0202020202020202ull, 0x0000020202020101ull,
+    0x0202020202020000ull, 0x0202020202020202ull, 0x0202020202020101ull,
+    0x0000000001010202ull, 0x0101020200000000ull, 0x0202020202020202ull,
+    0x0101020202020101ull, 0x0000020202020202ull, 0x0202010100000000ull,
+    0x0202010102020101ull, 0x0202020202020202ull, 0x0000000000000101ull,
+    0x0202010100000000ull, 0x0101010102020202ull, 0x0202010102020202ull,
+    0x0000000002020202ull, 0x0101000000000000ull, 0x0101020200000000ull,
+    0x0101000002020202ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0202020200000000ull, 0x0000000002020000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000010100000000ull,
+    0x0101020200000000ull, 0x0000000002020101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101020000000000ull, 0x0202010100000000ull,
+    0x0202020202020202ull, 0x0000000002020101ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0202010100000000ull, 0x0202020000000000ull, 0x0202020201010202ull,
+    0x0000020201010202ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0202010102020000ull,
+    0x0101010100000000ull, 0x0202010102020202ull, 0x0000010102020202ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000002020000ull, 0x0202020202000101ull,
+    0x0202020202020202ull, 0x0000020202020202ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000001010202ull, 0x0202020202020200ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000101ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202010102020202ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0202000000000101ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0101020202020202ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0202000001010000ull, 0x0202020202020202ull, 0x0202010102020202ull,
+    0x0002020202020202ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0202020202020202ull, 0x0101020202020202ull, 0x0000000000000202ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0101000000000000ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0000020200000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0202020200000000ull, 0x0000000002020202ull,
+    0x0101020202020000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000001010000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000010102020202ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000101ull, 0x0000000001010000ull,
+    0x0000000000000101ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000003030000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000003030000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030000ull, 0x0000000000000000ull, 0x0000000003030000ull,
+    0x0000000000000000ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000003030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000003030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000000000000ull, 0x0000000003030303ull, 0x0000000000000000ull,
+    0x0000000003030303ull, 0x0000000000000000ull, 0x0000000000000000ull,
+    0x0003030300000000ull, 0x0000000003030303ull, 0x0000000003030000ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0000000003030000ull, 0x0003030300000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0000000003030000ull, 0x0003030300000000ull, 0x0000000003030303ull,
+    0x0000000003030000ull, 0x0003030300000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000003030303ull, 0x0000000003030000ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000000000000ull, 0x0000000003030303ull,
+    0x0000000003030000ull, 0x0003030300000000ull, 0x0000000003030303ull,
+    0x0003030300000000ull, 0x0000000003030303ull, 0x0000000003030000ull,
+    0x0003030300000000ull, 0x0003030300000303ull, 0x0000030303030303ull,
+    0x0003030303030000ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0103030300000303ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030300000303ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030300000303ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000030303030303ull,
+    0x0003030303030000ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000000000000000ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030300000303ull,
+    0x0000030303030303ull, 0x0003030300000303ull, 0x0000030303030303ull,
+    0x0003030303030000ull, 0x0003030300000303ull, 0x0203030303030303ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0003030303030000ull,
+    0x0003030303030303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0003030303030000ull,
+    0x0003030303030303ull, 0x0000030303030303ull, 0x0003030303030000ull,
+    0x0003030303030303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0000000000000303ull, 0x0000030303030303ull, 0x0203030303030000ull,
+    0x0203030303030303ull, 0x0201030303030303ull, 0x0203030303030303ull,
+    0x0000030303030303ull, 0x0003030303030000ull, 0x0003030303030303ull,
+    0x0103030303030303ull, 0x0000030303030303ull, 0x0103030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0000030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0000030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0002030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0000030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0202030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0000030303030303ull,
+    0x0003030303030303ull, 0x0003030303030303ull, 0x0000030303030303ull,
+    0x0103030303030303ull, 0x0000030303030303ull, 0x0003030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0000030303030303ull,
+    0x0003030303030303ull, 0x0000000003030303ull, 0x0000030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0102030303030303ull,
+    0x0103030303030303ull, 0x0102030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0003030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0000000303030303ull,
+    0x0003030303030303ull, 0x0003030303030303ull, 0x0000000303030303ull,
+    0x0003030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0000000303030303ull,
+    0x0003030303030303ull, 0x0003030303030303ull, 0x0202020303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0003030303030303ull, 0x0003030303030303ull,
+    0x0003030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0003030303030303ull, 0x0000000303030303ull,
+    0x0003030303030303ull, 0x0003030303030303ull, 0x0000000303030303ull,
+    0x0003030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103010103030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0003030303030303ull, 0x0003030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101010101010303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0003030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301010103ull, 0x0103030101030303ull, 0x0101010101010303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030101030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030101010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0003030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030101030101ull, 0x0203010101010303ull,
+    0x0203030101010103ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030101030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030101030103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030101ull,
+    0x0103010303010103ull, 0x0103030101030103ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030301010303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030101030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030101ull, 0x0203010101010103ull, 0x0203030101030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103010101010303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103010103030303ull,
+    0x0103010103030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030103010101ull, 0x0103010103030101ull,
+    0x0103010103030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203010101010101ull, 0x0203030303010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203010103030303ull, 0x0203010103030101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030101010103ull,
+    0x0203030101030101ull, 0x0203010103030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301010101ull,
+    0x0103030303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103010103030303ull, 0x0103010103030101ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301010303ull, 0x0103030101030303ull, 0x0103010103030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030101030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203010101030101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103010103030303ull, 0x0103030101030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101010101010101ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103010201020303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203010103030101ull, 0x0201010103030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201010301010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103010201020303ull, 0x0103030303030303ull, 0x0103010103030101ull,
+    0x0101010101010303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030102ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101010303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0102010201020102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0201020102010201ull, 0x0203030303030303ull,
+    0x0203010101030101ull, 0x0203030101010303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030302010201ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203020102010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0102010201020102ull,
+    0x0103030303030303ull, 0x0101010101010101ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301020102ull, 0x0103030301020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030101010103ull, 0x0103030303030303ull, 0x0103030301020303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203020102010201ull, 0x0203030303030303ull, 0x0201010301010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030302010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030301010101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030301020303ull, 0x0103030303030303ull,
+    0x0101010303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030101ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030103030101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0102010201020102ull, 0x0103030303030303ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030101ull, 0x0103030303030102ull, 0x0103010201020303ull,
+    0x0103030303030303ull, 0x0103030303030102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030301010103ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203020102010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030101ull, 0x0203030303030303ull,
+    0x0201020102010201ull, 0x0203030303030303ull, 0x0203030302010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203010303010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020303ull,
+    0x0103030303030303ull, 0x0102030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030101ull,
+    0x0102030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030301020102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103010101010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303010101ull, 0x0203030303030303ull, 0x0203020102010201ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030101010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303010103ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303010103ull, 0x0103030301010103ull,
+    0x0103030301020303ull, 0x0103030303030303ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101010303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103010201020303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030101010303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201010303010103ull,
+    0x0203030101030101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0201010301010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103010201020303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101010101010103ull, 0x0103030103030101ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0101010101010101ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0102010201020102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201020102010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203010101010103ull, 0x0203010103030101ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201030101030101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203020102010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101010303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101030101030101ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0201010303010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201030101030101ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301020303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0101010101010303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101030303030101ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203010101030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0101010303030101ull,
+    0x0103030303030303ull, 0x0103030303030102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201010303030101ull, 0x0203030303030303ull, 0x0203030302010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020103030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101010303010103ull, 0x0103030303030303ull,
+    0x0103030301020102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0102010201020303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203010103010103ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0102030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103010103010103ull, 0x0103030101010103ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0102010203030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030101ull,
+    0x0103030101010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103010201020303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203010103010103ull, 0x0203030301010101ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201010303030101ull, 0x0203030303010101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201020102010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030101010303ull,
+    0x0103030303030101ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101010303030101ull, 0x0103030303030101ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030101030303ull, 0x0203030103030101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201010303030101ull,
+    0x0203030101010101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301010103ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301010103ull,
+    0x0101010303030101ull, 0x0103010101010103ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030302010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203010303010103ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030101030101ull, 0x0203010103010103ull, 0x0203010103030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103010101010103ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030103030101ull, 0x0103010101010103ull,
+    0x0103010101030101ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030101010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203010103030101ull,
+    0x0203030101010303ull, 0x0203030101010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103010201020303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0101010303010103ull,
+    0x0101010303010103ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0201020102010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0101010301010103ull, 0x0201010303010103ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0101010101010101ull, 0x0101010101010303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0101030101030101ull,
+    0x0203010101030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301020303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0101030101030101ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0101030101030101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0101030303030101ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030101ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0101010303010103ull, 0x0103030303030101ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203010103010103ull, 0x0203030303030101ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030101010103ull,
+    0x0103030303030101ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030301010103ull, 0x0203030303010101ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030101030101ull, 0x0103030303010103ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030102ull, 0x0103030303030303ull,
+    0x0103030303030102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030101030101ull,
+    0x0201010303010103ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020103030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103010103030101ull, 0x0101010101010103ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0102010201020303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203010101010103ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301020102ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0102010203030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030301020102ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030302010201ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030302010303ull,
+    0x0203030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0102010201020102ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030303030303ull, 0x0103030303030303ull, 0x0103030303030303ull,
+    0x0103030301020102ull, 0x0103030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0201020102010201ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030303030303ull, 0x0203030303030303ull,
+    0x0203030303030303ull, 0x0203030302010201ull, 0x0203030303030303ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0201020102010201ull,
+    0x0201020102010201ull, 0x0201020102010201ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0102010201020102ull, 0x0102010201020102ull, 0x0102010201020102ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+    0x0202020202020202ull, 0x0202020202020202ull, 0x0202020202020202ull,
+};
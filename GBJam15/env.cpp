@@ -0,0 +1,168 @@
+#include "env.h"
+#include "gamestate.h"
+#include <atomic>
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+const int ENV_WIDTH = 160;
+const int ENV_HEIGHT = 144;
+
+static_assert(sizeof(EnvShared) == ENV_PIXELS_OFFSET,
+              "pixels must start right after the header");
+
+struct GameEnv {
+  GameStateData* pGame;
+  ButState buttons;
+  int frameSkip;
+  int maxSteps;
+
+  // Render target and RGB444 -> palette index
+  uint16_t* frame;
+  uint8_t toIndex[4096];
+
+  // Observation
+  uint8_t* pShared;
+  int sharedSize;
+  bool isPrivate;
+#ifdef _WIN32
+  HANDLE hMapping;
+#else
+  char shmName[256];
+#endif
+};
+
+static uint8_t* MapShared(GameEnv& env, const char* shmName) {
+#ifdef _WIN32
+  env.hMapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr,
+                                    PAGE_READWRITE, 0, env.sharedSize, shmName);
+  if (env.hMapping == nullptr) return nullptr;
+  return (uint8_t*)MapViewOfFile(env.hMapping, FILE_MAP_ALL_ACCESS, 0, 0,
+                                 env.sharedSize);
+#else
+  snprintf(env.shmName, sizeof(env.shmName), "/%s", shmName);
+  int fd = shm_open(env.shmName, O_CREAT | O_RDWR, 0600);
+  if (fd < 0) return nullptr;
+  void* p = nullptr;
+  if (ftruncate(fd, env.sharedSize) == 0) {
+    p = mmap(nullptr, env.sharedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+             0);
+  }
+  close(fd);
+  return (p == MAP_FAILED) ? nullptr : (uint8_t*)p;
+#endif
+}
+
+static void UnmapShared(GameEnv& env) {
+#ifdef _WIN32
+  UnmapViewOfFile(env.pShared);
+  CloseHandle(env.hMapping);
+#else
+  munmap(env.pShared, env.sharedSize);
+  shm_unlink(env.shmName);
+#endif
+}
+
+static void Observe(GameEnv& env) {
+  Rect srcRect = {0, 0, ENV_WIDTH, ENV_HEIGHT};
+  Render(env.pGame, env.frame, &srcRect);
+
+  uint8_t* pixels = env.pShared + ENV_PIXELS_OFFSET;
+  for (int i = 0; i < ENV_WIDTH * ENV_HEIGHT; ++i) {
+    pixels[i] = env.toIndex[env.frame[i] & 0xFFF];
+  }
+}
+
+GameEnv* EnvCreate(const GameAssets* pAssets, const char* shmName,
+                   int frameSkip, int maxSteps) {
+  GameEnv* pEnv = new GameEnv();
+  pEnv->frameSkip = (frameSkip > 0) ? frameSkip : 1;
+  pEnv->maxSteps = maxSteps;
+  pEnv->sharedSize = ENV_PIXELS_OFFSET + ENV_WIDTH * ENV_HEIGHT;
+  pEnv->pShared = nullptr;
+  pEnv->isPrivate = (shmName == nullptr);
+  if (shmName) {
+    pEnv->pShared = MapShared(*pEnv, shmName);
+    if (pEnv->pShared == nullptr) {
+      SDL_Log("Couldn't map shared memory %s", shmName);
+      delete pEnv;
+      return nullptr;
+    }
+  } else {
+    pEnv->pShared = new uint8_t[pEnv->sharedSize];
+  }
+  memset(pEnv->pShared, 0, pEnv->sharedSize);
+
+  EnvShared* pHeader = (EnvShared*)pEnv->pShared;
+  pHeader->magic = ENV_MAGIC;
+  pHeader->width = ENV_WIDTH;
+  pHeader->height = ENV_HEIGHT;
+
+  pEnv->pGame = GameSetupWithAssets(pAssets, ENV_WIDTH, ENV_HEIGHT, 0);
+  pEnv->frame = new uint16_t[ENV_WIDTH * ENV_HEIGHT];
+  GamePaletteIndexTable(pEnv->toIndex);
+  return pEnv;
+}
+
+void EnvDestroy(GameEnv* pEnv) {
+  if (pEnv == nullptr) return;
+  if (pEnv->isPrivate)
+    delete[] pEnv->pShared;
+  else
+    UnmapShared(*pEnv);
+  GameDestroy(pEnv->pGame);
+  delete[] pEnv->frame;
+  delete pEnv;
+}
+
+const uint8_t* EnvReset(GameEnv* pEnv, uint32_t seed) {
+  GameInit(*pEnv->pGame, pEnv->pGame->assets, ENV_WIDTH, ENV_HEIGHT, seed);
+  pEnv->buttons = ButState{0, 0, 0, 0};
+  Observe(*pEnv);
+
+  EnvShared* pHeader = (EnvShared*)pEnv->pShared;
+  pHeader->episode++;
+  pHeader->reward = 0;
+  pHeader->done = 0;
+  std::atomic_thread_fence(std::memory_order_release);
+  pHeader->step = 0;
+  return EnvObservation(pEnv);
+}
+
+int EnvStep(GameEnv* pEnv, int action, int* pDone) {
+  EnvShared* pHeader = (EnvShared*)pEnv->pShared;
+  int reward = 0;
+  for (int t = 0; t < pEnv->frameSkip; ++t) {
+    pEnv->buttons = GameHeldButtons(action, GameButtonBits(pEnv->buttons));
+    Tick(pEnv->pGame, &pEnv->buttons);
+    reward += (GameTakeSounds(pEnv->pGame) >> SND_FIGHT) & 1;
+  }
+  Observe(*pEnv);
+
+  uint32_t step = pHeader->step + 1;
+  pHeader->reward = reward;
+  pHeader->done = (pEnv->maxSteps > 0) && ((int)step >= pEnv->maxSteps);
+  std::atomic_thread_fence(std::memory_order_release);
+  pHeader->step = step;
+
+  if (pDone) *pDone = pHeader->done;
+  return reward;
+}
+
+const uint8_t* EnvObservation(GameEnv* pEnv) {
+  return pEnv->pShared + ENV_PIXELS_OFFSET;
+}
+
+const EnvShared* EnvGetShared(GameEnv* pEnv) {
+  return (const EnvShared*)pEnv->pShared;
+}
+
+int EnvSharedSize(GameEnv* pEnv) {
+  return pEnv->sharedSize;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Reinforcement learning environment: reset, step(action), observation.
+// The observation is the frame as one palette index (0-3, darkest first)
+// per pixel, written straight into a named shared memory segment laid out
+// as an EnvShared header followed by the pixels. A local process maps the
+// same segment and reads frames in place, e.g. from Python:
+//
+//   mm = mmap.mmap(-1, size, tagname=name)           # Windows
+//   mm = mmap.mmap(os.open("/dev/shm/" + name, os.O_RDWR), size)  # Linux
+//   frame = np.frombuffer(mm, np.uint8, h * w, ENV_PIXELS_OFFSET).reshape(h, w)
+//
+// Everything in the segment is written before EnvReset/EnvStep return.
+struct GameEnv;
+
+// Action bits as GameButtonBits packs them, any combination is one of 16
+enum EnvAction { ACT_UP = 1, ACT_DOWN = 2, ACT_LEFT = 4, ACT_RIGHT = 8 };
+
+const uint32_t ENV_MAGIC = 0x56454247;  // "GBEV"
+const int ENV_PIXELS_OFFSET = 32;
+
+struct EnvShared {
+  uint32_t magic;
+  uint16_t width, height;
+  uint32_t episode;
+  uint32_t step;     // In this episode, bumped last so it can be polled
+  int32_t reward;    // Of the last step, windows got into
+  uint32_t done;
+  uint32_t pad[2];
+};
+
+// shmName null keeps the observation in private memory. Each step repeats
+// the action for frameSkip ticks and renders once, episodes end after
+// maxSteps steps.
+GameEnv* EnvCreate(const GameAssets* pAssets, const char* shmName,
+                   int frameSkip, int maxSteps);
+void EnvDestroy(GameEnv* pEnv);
+
+// Starts an episode, returns the first observation
+const uint8_t* EnvReset(GameEnv* pEnv, uint32_t seed);
+// Returns the reward, pDone (optional) set at the end of an episode
+int EnvStep(GameEnv* pEnv, int action, int* pDone);
+
+const uint8_t* EnvObservation(GameEnv* pEnv);
+const EnvShared* EnvGetShared(GameEnv* pEnv);
+int EnvSharedSize(GameEnv* pEnv);
+};
@@ -0,0 +1,217 @@
+#pragma once
+#include "cat.h"
+#include "tiles.h"
+#include "timerwheel.h"
+#include <vector>
+#include <random>
+#include <memory>
+
+struct ParticleSystem;
+
+typedef std::vector<Pt> ListOfPt;
+typedef std::vector<Rect> ListOfRect;
+
+const int NUM_LAUNDRY_LINES = 4;
+
+// Level streaming
+const int CHUNK_WIDTH = 160;
+const int LEVEL_CHUNKS = 1 << 16;
+const int MAX_RESIDENT_CHUNKS = 8;
+const int MAX_BINS_PER_CHUNK = 4;
+const int WINDOWS_PER_CHUNK = 2;
+
+//// STATE
+
+struct CatData {
+  enum CState {
+    Idle,
+    Left,
+    Right,
+    Down,
+    DownLeft,
+    DownRight,
+    Up,
+    PounceLeft,
+    PounceRight,
+    Hold
+  } state;
+  Pt pos;
+  Pt holdPos;
+  int framesRunning;
+  int upFrames;
+  TimerHandle noLandTimer;  // Pending while dropping through a ledge
+  bool isRunning;
+  bool isGrounded;
+};
+
+struct SpriteData {
+  enum Anchor {
+    TOP_LEFT,
+    TOP,
+    TOP_RIGHT,
+    LEFT,
+    MIDDLE,
+    RIGHT,
+    BOTTOM_LEFT,
+    BOTTOM,
+    BOTTOM_RIGHT
+  };
+  const uint8_t* pixs;  // Palette indices, 0 is see through
+  int sprPitch;
+  ListOfRect sprRect;
+
+  // Collision masks, see collision.h. Sprite i's rows start at
+  // maskRows[maskFirst[i]], followed by the same rows mirrored.
+  std::vector<uint64_t> maskRows;
+  std::vector<int> maskFirst;
+};
+
+struct BackgroundData {
+  const uint8_t* pixs;
+  Rect size;
+};
+
+struct PixData {
+  uint16_t* pixs;
+  Rect size;
+  bool isTiled;  // See tiles.h
+
+  int GetI(const Pt& p) const;
+
+  // From the top left pixel rather than in world coordinates
+  int LocalI(int x, int y) const {
+    return isTiled ? TiledIndex(x, y, size.w) : x + y * size.w;
+  }
+
+  // Pixels from x towards xEnd that follow each other in pixs, the rest of
+  // the row or of x's tile. Spans are written a run at a time.
+  int RunLength(int x, int xEnd) const {
+    if (!isTiled) return xEnd - x;
+    int tileEnd = x + TILE_SIZE - ((x - size.x) & (TILE_SIZE - 1));
+    return ((tileEnd < xEnd) ? tileEnd : xEnd) - x;
+  }
+
+  // Index after a run of n that started at c, on the same row
+  int NextRun(int c, int n) const {
+    return c + n + (isTiled ? TILE_PIXELS - TILE_SIZE : 0);
+  }
+};
+
+struct LaundryData {
+  int xStep;
+  int laundryType;
+};
+
+typedef std::vector<LaundryData> LaundryList;
+
+// Laundry is shared between forks of a game until one of them changes it
+struct LaundryLineData {
+  int offset;
+  int scrollDir;
+  int lineHeight;
+  std::shared_ptr<LaundryList> pLaundry;
+
+  const LaundryList& Laundry() const { return *pLaundry; }
+
+  // Call before changing the laundry, copies it first if it's shared
+  LaundryList& MutableLaundry() {
+    if (!pLaundry)
+      pLaundry = std::make_shared<LaundryList>();
+    else if (pLaundry.use_count() > 1)
+      pLaundry = std::make_shared<LaundryList>(*pLaundry);
+    return *pLaundry;
+  }
+};
+
+// A slice of alley, rebuilt from the seed and its index when it streams in
+struct LevelChunk {
+  int index;
+  int numBins;
+  Rect bins[MAX_BINS_PER_CHUNK];
+  uint8_t windowRows[WINDOWS_PER_CHUNK];  // Bit per laundry line
+};
+
+// Named run of the sheet's sprites, what SPR_BASE_* and SPR_* index by
+struct SheetSection {
+  const char* name;
+  int base;
+  int count;
+};
+
+extern const SheetSection SHEET_SECTIONS[];
+extern const int NUM_SHEET_SECTIONS;
+
+// Loaded once and shared read-only by every game instance
+struct GameAssets {
+  SpriteData sprites;
+  BackgroundData floor;
+  int laundryWidth[4];
+};
+
+// Flat apart from the laundry, so copying one (see GameFork) is a few KB
+// of memcpy and four reference counts
+struct GameStateData {
+  int screen_width, screen_height;
+  const GameAssets* assets;
+  CatData cat;
+  CatData cat2;  // Second player, see numCats
+  int numCats;
+  int windowsWon[2];  // Per cat
+  Pt scrollPoint;
+  Rect level_bounds;
+  uint32_t seed;
+  std::mt19937 randGen;
+
+  // Alley, chunks [firstChunk, firstChunk + numChunks) are resident and
+  // laundry covers exactly that span
+  LevelChunk chunks[MAX_RESIDENT_CHUNKS];
+  int firstChunk;
+  int numChunks;
+  LaundryLineData lines[NUM_LAUNDRY_LINES];
+  int movingLine;
+  bool isLineMoving;
+  TimerHandle lineTimer;
+  bool isMeowUnlocked;
+  int activeWindow;  // Window column * NUM_LAUNDRY_LINES + line
+  uint32_t windowOpenTick;  // In timers.now ticks
+  TimerHandle windowTimer;
+
+  // Game timers, ticked once at the start of Tick
+  TimerWheel timers;
+
+  int animCount;
+
+  // Cosmetic effects, not hashed or saved, nullptr for none (batch games)
+  ParticleSystem* pParticles;
+  GameAssets* pOwnedAssets;  // Freed with the game, GameSetup's own load
+  uint32_t sounds;  // GameSound bits waiting for GameTakeSounds
+
+  CatData& Cat(int i) { return i ? cat2 : cat; }
+
+  // i-th resident chunk from the left
+  LevelChunk& Chunk(int i) {
+    return chunks[(firstChunk + i) % MAX_RESIDENT_CHUNKS];
+  }
+  const LevelChunk& Chunk(int i) const {
+    return chunks[(firstChunk + i) % MAX_RESIDENT_CHUNKS];
+  }
+};
+
+// Sprites found by their frame markers in an 8 bit sheet, the pixels are
+// copied so the sheet can go
+void SliceSprites(SpriteData& sprData, const uint8_t* pixs, int width,
+                  int height);
+void SetupSprites(SpriteData& sprData, const char* filename);
+void SetupBackground(BackgroundData& bgData, const char* filename);
+
+// Fills in what's derived from the sprites, false if the sheet is missing
+// or short of sprites
+bool GameFinishAssets(GameAssets* pAssets);
+
+// Window (column * NUM_LAUNDRY_LINES + line) in the cats' coordinates: x
+// along the level, y up from the ground to its bottom edge
+Rect WindowRect(const GameStateData& gameState, int window);
+
+// Inits a game in place, used by GameSetup and the batch runner
+void GameInit(GameStateData& gameState, const GameAssets* pAssets,
+              uint16_t width, uint16_t height, uint32_t seed);
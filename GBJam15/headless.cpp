@@ -0,0 +1,616 @@
+// Headless runner: drives GameSetup/Tick/Render into a memory framebuffer
+// with no window, vsync or sleeping. Needs SDL only for file loading, logs
+// and timers so it runs on display-less build machines. The art is compiled
+// in (see atlas.h) so it runs from any directory, though sprites.bmp and
+// floor.bmp win if they're here and have changed since it was made.
+//
+//   -frames N     ticks to run (default 30 * 60 * 5)
+//   -seed N       game seed (default 1)
+//   -script file  scripted input, lines of "<ticks> <buttons>" e.g. "30 UR"
+//   -replay file  play back a recorded session instead
+//   -norender     tick only
+//   -batch N      tick N games through the batch API instead
+//   -threads N    job system threads for batch and loading (default: cores)
+//   -wav file     synthesize the game's sound effects into a WAV too
+//   -bot          let the search bot play instead of a script
+//   -env          step the RL environment with random actions instead
+//   -net L R      two player rollback game, UDP port L to port R
+//   -host addr    other side's IPv4 address (default 127.0.0.1)
+//   -player N     cat this side plays, 0 or 1
+//   -delay N      ticks of local input delay
+//   -latency ms   delay what this side sends, to fake a network
+//   -jitter ms    random extra delay on top
+//   -loss N       percent of packets this side drops
+//   -broadcast P  stream frames to spectators on TCP port P
+//   -viewers N    wait for N spectators before starting
+//   -watch addr P spectate a broadcast instead, hash what arrives
+//   -bmp          load sprites.bmp and floor.bmp rather than the built in art
+//   -atlas file   load the sprites and floor from a baked atlas
+//   -bake file    bake sprites.bmp and floor.bmp into an atlas and exit
+//   -embed file   bake them into embeddedassets.cpp source and exit
+//   -tiled        render into 8x8 tiles, made linear again for hashing
+//   -tilebench    time linear against tiled drawing as sprite counts grow
+#include "SDL.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+
+#include "apu.h"
+#include "atlas.h"
+#include "bot.h"
+#include "broadcast.h"
+#include "cat.h"
+#include "env.h"
+#include "netplay.h"
+#include "batch.h"
+#include "jobs.h"
+#include "replay.h"
+#include "tiles.h"
+
+#define GB_WIDTH 160
+#define GB_HEIGHT 144
+#define AUDIO_RATE 48000
+#define TICK_RATE 30
+
+struct ScriptStep {
+  int ticks;
+  ButState held;
+};
+
+static bool LoadScript(const char *filename, std::vector<ScriptStep> &script) {
+  std::ifstream in(filename);
+  if (!in) {
+    std::cout << "ERROR: can't open script " << filename << std::endl;
+    return false;
+  }
+
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.empty() || (line[0] == '#')) continue;
+
+    ScriptStep step = {0, {0, 0, 0, 0}};
+    step.ticks = atoi(line.c_str());
+    size_t sp = line.find(' ');
+    if (sp != std::string::npos) {
+      for (size_t i = sp + 1; i < line.size(); ++i) {
+        switch (line[i]) {
+          case 'U': step.held.up = 1; break;
+          case 'D': step.held.down = 1; break;
+          case 'L': step.held.left = 1; break;
+          case 'R': step.held.right = 1; break;
+        }
+      }
+    }
+    if (step.ticks > 0) script.push_back(step);
+  }
+  return true;
+}
+
+// Newly held buttons count as pressed this tick like a key down
+static void ApplyHeld(ButState &buttons, const ButState &held) {
+  buttons.up = held.up ? (buttons.up ? buttons.up : 3) : 0;
+  buttons.down = held.down ? (buttons.down ? buttons.down : 3) : 0;
+  buttons.left = held.left ? (buttons.left ? buttons.left : 3) : 0;
+  buttons.right = held.right ? (buttons.right ? buttons.right : 3) : 0;
+}
+
+static uint32_t HashFrame(uint32_t h, const uint16_t *pixs, int count) {
+  for (int i = 0; i < count; ++i) {
+    h = (h ^ pixs[i]) * 16777619u;
+  }
+  return h;
+}
+
+static void PutLE(std::ofstream &out, uint32_t v, int bytes) {
+  for (int i = 0; i < bytes; ++i) out.put((char)((v >> (i * 8)) & 0xFF));
+}
+
+// 16-bit stereo PCM
+static bool WriteWav(const char *filename, const std::vector<int16_t> &samples,
+                     int rate) {
+  std::ofstream out(filename, std::ios::binary);
+  if (!out) {
+    std::cout << "ERROR: can't write " << filename << std::endl;
+    return false;
+  }
+
+  uint32_t dataBytes = (uint32_t)(samples.size() * sizeof(int16_t));
+  out.write("RIFF", 4);
+  PutLE(out, 36 + dataBytes, 4);
+  out.write("WAVEfmt ", 8);
+  PutLE(out, 16, 4);        // Chunk size
+  PutLE(out, 1, 2);         // PCM
+  PutLE(out, 2, 2);         // Channels
+  PutLE(out, rate, 4);
+  PutLE(out, rate * 4, 4);  // Bytes per second
+  PutLE(out, 4, 2);         // Bytes per frame
+  PutLE(out, 16, 2);        // Bits
+  out.write("data", 4);
+  PutLE(out, dataBytes, 4);
+  for (size_t i = 0; i < samples.size(); ++i) {
+    PutLE(out, (uint16_t)samples[i], 2);
+  }
+  return true;
+}
+
+static double Seconds(Uint64 counts) {
+  return (double)counts / (double)SDL_GetPerformanceFrequency();
+}
+
+static int RunBatch(JobSystem *pJobs, GameAssets *pAssets, int numGames,
+                    int frames, uint32_t seed) {
+  GameBatch *pBatch =
+      BatchCreate(pAssets, numGames, GB_WIDTH, GB_HEIGHT, seed, pJobs);
+  std::vector<ButState> inputs(numGames);
+  for (int i = 0; i < numGames; ++i) {
+    inputs[i] = ButState{0, 0, (i & 1) ? 1 : 0, (i & 1) ? 0 : 1};
+  }
+
+  Uint64 start = SDL_GetPerformanceCounter();
+  BatchStep(pBatch, &inputs[0], frames);
+  double wall = Seconds(SDL_GetPerformanceCounter() - start);
+
+  uint64_t ticks = 0;
+  double busy = 0;
+  BatchGetStats(pBatch, &ticks, &busy);
+  std::cout << "BATCH: " << numGames << " games " << ticks << " ticks in "
+            << wall << "s, " << (busy > 0 ? ticks / busy : 0)
+            << " ticks/s per core" << std::endl;
+
+  BatchDestroy(pBatch);
+  return 0;
+}
+
+// Spectate until the server goes, the last frame should match its own
+static int RunWatch(const char *host, int port) {
+  BroadcastView *pView = BroadcastConnect(host, port);
+  if (pView == nullptr) return -1;
+
+  uint16_t *pixs = new uint16_t[GB_WIDTH * GB_HEIGHT];
+  int updates = 0;
+  bool hasFrame = false;
+  Uint64 start = SDL_GetPerformanceCounter();
+  for (;;) {
+    bool isNew;
+    bool isOpen = BroadcastReceive(pView, pixs, GB_WIDTH, GB_HEIGHT, &isNew);
+    if (isNew) {
+      hasFrame = true;
+      updates++;
+    }
+    if (!isOpen) break;
+    if (!isNew) SDL_Delay(1);
+  }
+  double wall = Seconds(SDL_GetPerformanceCounter() - start);
+
+  uint32_t lastHash =
+      hasFrame ? HashFrame(2166136261u, pixs, GB_WIDTH * GB_HEIGHT) : 0;
+  std::cout << "WATCH: " << updates << " updates in " << wall
+            << "s, last frame " << std::hex << lastHash << std::dec
+            << std::endl;
+  BroadcastDisconnect(pView);
+  delete[] pixs;
+  return 0;
+}
+
+// The same scattered sprites drawn linear and tiled, the tiled time then
+// includes making it linear
+static int RunTileBench(GameAssets *pAssets, uint32_t seed) {
+  GameStateData *pGameState =
+      GameSetupWithAssets(pAssets, GB_WIDTH, GB_HEIGHT, seed);
+  std::vector<uint16_t> linear(GB_WIDTH * GB_HEIGHT);
+  std::vector<uint16_t> tiles(GB_WIDTH * GB_HEIGHT);
+  std::vector<uint16_t> untiled(GB_WIDTH * GB_HEIGHT);
+  Rect srcRect = {0, 0, GB_WIDTH, GB_HEIGHT};
+  const int reps = 2000;
+  bool isSame = true;
+
+  for (int numSprites = 16; numSprites <= 4096; numSprites *= 4) {
+    Uint64 linearCounts = 0, tiledCounts = 0, untileCounts = 0;
+    for (int i = 0; i < reps; ++i) {
+      Uint64 t0 = SDL_GetPerformanceCounter();
+      RenderSpriteBench(pGameState, &linear[0], &srcRect, numSprites,
+                        seed + i, false);
+      Uint64 t1 = SDL_GetPerformanceCounter();
+      RenderSpriteBench(pGameState, &tiles[0], &srcRect, numSprites,
+                        seed + i, true);
+      Uint64 t2 = SDL_GetPerformanceCounter();
+      TilesToLinear(&tiles[0], &untiled[0], GB_WIDTH, GB_HEIGHT);
+      Uint64 t3 = SDL_GetPerformanceCounter();
+      linearCounts += t1 - t0;
+      tiledCounts += t2 - t1;
+      untileCounts += t3 - t2;
+      isSame = isSame && (linear == untiled);
+    }
+    std::cout << "TILES: " << numSprites << " sprites, linear "
+              << Seconds(linearCounts) * 1e6 / reps << "us tiled "
+              << Seconds(tiledCounts + untileCounts) * 1e6 / reps
+              << "us (" << Seconds(untileCounts) * 1e6 / reps
+              << "us to linear)" << std::endl;
+  }
+  std::cout << "TILES: tiled frames "
+            << (isSame ? "match linear" : "DIFFER from linear") << std::endl;
+
+  GameDestroy(pGameState);
+  return isSame ? 0 : -1;
+}
+
+// Random actions, 4 ticks a step, 1000 step episodes
+static int RunEnv(GameAssets *pAssets, int steps, uint32_t seed) {
+  GameEnv *pEnv = EnvCreate(pAssets, nullptr, 4, 1000);
+  if (pEnv == nullptr) return -1;
+  EnvReset(pEnv, seed);
+
+  uint32_t rand = seed;
+  int reward = 0, episodes = 1;
+  Uint64 start = SDL_GetPerformanceCounter();
+  for (int i = 0; i < steps; ++i) {
+    rand = rand * 1664525u + 1013904223u;
+    int done = 0;
+    reward += EnvStep(pEnv, (rand >> 28) & 0xF, &done);
+    if (done) {
+      EnvReset(pEnv, seed + episodes++);
+    }
+  }
+  double wall = Seconds(SDL_GetPerformanceCounter() - start);
+
+  uint32_t obsHash = 2166136261u;
+  const uint8_t *pObs = EnvObservation(pEnv);
+  for (int i = 0; i < GB_WIDTH * GB_HEIGHT; ++i) {
+    obsHash = (obsHash ^ pObs[i]) * 16777619u;
+  }
+  std::cout << "ENV: " << steps << " steps in " << wall << "s = "
+            << (wall > 0 ? steps / wall : 0) << " steps/s, " << episodes
+            << " episodes, reward " << reward << ", obs " << std::hex
+            << obsHash << std::dec << std::endl;
+
+  EnvDestroy(pEnv);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  int frames = 30 * 60 * 5;
+  uint32_t seed = 1;
+  const char *scriptFile = nullptr;
+  const char *replayFile = nullptr;
+  bool doRender = true;
+  int batchGames = 0;
+  int numThreads = 0;
+  const char *wavFile = nullptr;
+  bool useBot = false;
+  bool useEnv = false;
+  NetConfig netConfig = {0, 0, "127.0.0.1", 0, 0, 0, 0, 0};
+  bool useNet = false;
+  int broadcastPort = 0;
+  int numViewers = 0;
+  const char *watchHost = nullptr;
+  int watchPort = 0;
+  const char *atlasFile = nullptr;
+  const char *bakeFile = nullptr;
+  const char *embedFile = nullptr;
+  bool useBmp = false;
+  bool useTiles = false;
+  bool tileBench = false;
+
+  for (int i = 1; i < argc; ++i) {
+    if ((strcmp(argv[i], "-frames") == 0) && (i + 1 < argc))
+      frames = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-seed") == 0) && (i + 1 < argc))
+      seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    else if ((strcmp(argv[i], "-script") == 0) && (i + 1 < argc))
+      scriptFile = argv[++i];
+    else if ((strcmp(argv[i], "-replay") == 0) && (i + 1 < argc))
+      replayFile = argv[++i];
+    else if (strcmp(argv[i], "-norender") == 0)
+      doRender = false;
+    else if ((strcmp(argv[i], "-batch") == 0) && (i + 1 < argc))
+      batchGames = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-threads") == 0) && (i + 1 < argc))
+      numThreads = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-wav") == 0) && (i + 1 < argc))
+      wavFile = argv[++i];
+    else if (strcmp(argv[i], "-bot") == 0)
+      useBot = true;
+    else if (strcmp(argv[i], "-env") == 0)
+      useEnv = true;
+    else if ((strcmp(argv[i], "-net") == 0) && (i + 2 < argc)) {
+      useNet = true;
+      netConfig.localPort = atoi(argv[++i]);
+      netConfig.remotePort = atoi(argv[++i]);
+    } else if ((strcmp(argv[i], "-host") == 0) && (i + 1 < argc))
+      netConfig.remoteHost = argv[++i];
+    else if ((strcmp(argv[i], "-player") == 0) && (i + 1 < argc))
+      netConfig.localPlayer = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-delay") == 0) && (i + 1 < argc))
+      netConfig.inputDelay = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-latency") == 0) && (i + 1 < argc))
+      netConfig.latencyMs = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-jitter") == 0) && (i + 1 < argc))
+      netConfig.jitterMs = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-loss") == 0) && (i + 1 < argc))
+      netConfig.lossPercent = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-broadcast") == 0) && (i + 1 < argc))
+      broadcastPort = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-viewers") == 0) && (i + 1 < argc))
+      numViewers = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-watch") == 0) && (i + 2 < argc)) {
+      watchHost = argv[++i];
+      watchPort = atoi(argv[++i]);
+    } else if ((strcmp(argv[i], "-atlas") == 0) && (i + 1 < argc))
+      atlasFile = argv[++i];
+    else if ((strcmp(argv[i], "-bake") == 0) && (i + 1 < argc))
+      bakeFile = argv[++i];
+    else if ((strcmp(argv[i], "-embed") == 0) && (i + 1 < argc))
+      embedFile = argv[++i];
+    else if (strcmp(argv[i], "-bmp") == 0)
+      useBmp = true;
+    else if (strcmp(argv[i], "-tiled") == 0)
+      useTiles = true;
+    else if (strcmp(argv[i], "-tilebench") == 0)
+      tileBench = true;
+  }
+  if (watchHost) return RunWatch(watchHost, watchPort);
+
+  JobSystem *pJobs = JobSystemCreate(numThreads);
+  Uint64 loadStart = SDL_GetPerformanceCounter();
+  GameAssets *pAssets = nullptr;
+  const char *assetSource = "built in";
+  if (atlasFile) {
+    pAssets = AtlasLoad(atlasFile);
+    assetSource = atlasFile;
+  } else if (!useBmp && !bakeFile && !embedFile) {
+    // The game loads the BMPs, so after an edit the built in art would
+    // collide and lay out laundry differently and replays would diverge
+    uint32_t sourceHash = AtlasSourceHash("sprites.bmp", "floor.bmp");
+    if ((sourceHash != 0) && (sourceHash != AtlasEmbeddedSourceHash())) {
+      std::cout << "HEADLESS: sprites.bmp or floor.bmp changed since the "
+                   "built in art was made (headless -embed), using them"
+                << std::endl;
+    } else {
+      pAssets = AtlasLoadEmbedded();
+    }
+  }
+  if ((pAssets == nullptr) && !atlasFile) {
+    pAssets = GameLoadAssetsWithJobs(pJobs, "sprites.bmp", "floor.bmp");
+    assetSource = "sprites.bmp";
+  }
+  if (pAssets == nullptr) {
+    std::cout << "HEADLESS: no assets from " << assetSource << std::endl;
+    JobSystemDestroy(pJobs);
+    return -1;
+  }
+  std::cout << "HEADLESS: " << assetSource << " assets loaded in "
+            << Seconds(SDL_GetPerformanceCounter() - loadStart) * 1e3 << "ms"
+            << std::endl;
+  if (bakeFile || embedFile) {
+    uint32_t sourceHash = AtlasSourceHash("sprites.bmp", "floor.bmp");
+    bool isWritten =
+        bakeFile ? AtlasWrite(pAssets, sourceHash, bakeFile)
+                 : AtlasWriteSource(pAssets, sourceHash, embedFile);
+    JobSystemDestroy(pJobs);
+    return isWritten ? 0 : -1;
+  }
+  if (batchGames > 0) {
+    int res = RunBatch(pJobs, pAssets, batchGames, frames, seed);
+    JobSystemDestroy(pJobs);
+    return res;
+  }
+  if (useEnv) {
+    int res = RunEnv(pAssets, frames, seed);
+    JobSystemDestroy(pJobs);
+    return res;
+  }
+  if (tileBench) {
+    int res = RunTileBench(pAssets, seed);
+    JobSystemDestroy(pJobs);
+    return res;
+  }
+
+  // Input source
+  std::vector<ScriptStep> script;
+  if (scriptFile && !LoadScript(scriptFile, script)) return -1;
+
+  InputLog *pLog = nullptr;
+  ReplayPlayer *pPlayer = nullptr;
+  GameStateData *pGameState = nullptr;
+  if (replayFile) {
+    pLog = InputLogLoad(replayFile);
+    if (pLog == nullptr) return -1;
+    pPlayer = ReplayPlayerCreate(pLog, pAssets);
+    pGameState = ReplayGetGame(pPlayer);
+    frames = InputLogNumTicks(pLog);
+  } else {
+    pGameState = GameSetupWithAssets(pAssets, GB_WIDTH, GB_HEIGHT, seed);
+  }
+
+  uint16_t *pixs = new uint16_t[GB_WIDTH * GB_HEIGHT];
+  uint16_t *tiles = useTiles ? new uint16_t[GB_WIDTH * GB_HEIGHT] : nullptr;
+  Rect srcRect = {0, 0, GB_WIDTH, GB_HEIGHT};
+  ButState buttons = {0, 0, 0, 0};
+  size_t scriptStep = 0;
+  int scriptTicksLeft = script.empty() ? 0 : script[0].ticks;
+  uint32_t frameHash = 2166136261u;
+  Uint64 tickCounts = 0, renderCounts = 0;
+
+  // Audio, one tick's worth of samples after each tick
+  Apu *pApu = wavFile ? ApuCreate(AUDIO_RATE) : nullptr;
+  std::vector<int16_t> audio;
+  const int tickFrames = AUDIO_RATE / TICK_RATE;
+
+  NetSession *pNet = nullptr;
+  if (useNet && !pPlayer) {
+    GameAddSecondCat(pGameState);
+    pNet = NetCreate(pGameState, &netConfig);
+    if (pNet == nullptr) return -1;
+  }
+
+  BroadcastServer *pBroadcast = nullptr;
+  if (broadcastPort && doRender) {
+    pBroadcast = BroadcastCreate(broadcastPort, GB_WIDTH, GB_HEIGHT);
+    if (pBroadcast == nullptr) return -1;
+    while (BroadcastNumViewers(pBroadcast) < numViewers) SDL_Delay(1);
+  }
+
+  PlayBot *pBot =
+      (useBot && !pPlayer && !pNet) ? BotCreate(pGameState) : nullptr;
+  int windowsEntered = 0;
+
+  Uint64 start = SDL_GetPerformanceCounter();
+  for (int f = 0; f < frames; ++f) {
+    Uint64 t0 = SDL_GetPerformanceCounter();
+    if (pPlayer) {
+      if (!ReplayStep(pPlayer)) break;
+    } else {
+      if (scriptStep < script.size()) {
+        ApplyHeld(buttons, script[scriptStep].held);
+        if (--scriptTicksLeft <= 0 && ++scriptStep < script.size())
+          scriptTicksLeft = script[scriptStep].ticks;
+      } else if (!script.empty()) {
+        buttons = ButState{0, 0, 0, 0};
+      } else if (pBot) {
+        BotThink(pBot, pGameState, &buttons);
+      }
+      if (pNet) {
+        while (!NetAdvance(pNet, &buttons)) SDL_Delay(1);
+      } else {
+        Tick(pGameState, &buttons);
+      }
+    }
+    Uint64 t1 = SDL_GetPerformanceCounter();
+    tickCounts += t1 - t0;
+
+    uint32_t sounds = (pApu || pBot) ? GameTakeSounds(pGameState) : 0;
+    windowsEntered += (sounds >> SND_FIGHT) & 1;
+    if (pApu) {
+      for (int i = 0; i < SND_COUNT; ++i) {
+        if ((sounds >> i) & 1) ApuPlaySound(pApu, i);
+      }
+      audio.resize(audio.size() + tickFrames * 2);
+      ApuRender(pApu, &audio[audio.size() - tickFrames * 2], tickFrames);
+    }
+
+    if (doRender) {
+      if (tiles) {
+        RenderTiled(pGameState, tiles, &srcRect);
+        TilesToLinear(tiles, pixs, GB_WIDTH, GB_HEIGHT);
+      } else {
+        Render(pGameState, pixs, &srcRect);
+      }
+      frameHash = HashFrame(frameHash, pixs, GB_WIDTH * GB_HEIGHT);
+      renderCounts += SDL_GetPerformanceCounter() - t1;
+      if (pBroadcast) BroadcastFrame(pBroadcast, pixs);
+    }
+  }
+
+  // Keep trading until the other side's last inputs are in and applied
+  if (pNet) {
+    NetStats stats;
+    Uint64 drainStart = SDL_GetPerformanceCounter();
+    for (;;) {
+      NetPoll(pNet);
+      NetGetStats(pNet, &stats);
+      bool isDone =
+          (stats.confirmedTick >= frames) && (stats.ackedTick >= frames);
+      if (isDone ||
+          (Seconds(SDL_GetPerformanceCounter() - drainStart) > 3.0))
+        break;
+      SDL_Delay(1);
+    }
+  }
+  if (pBroadcast) {
+    while (BroadcastFlush(pBroadcast) > 0) SDL_Delay(1);
+  }
+  double wall = Seconds(SDL_GetPerformanceCounter() - start);
+
+  std::cout << "HEADLESS: " << frames << " frames in " << wall << "s = "
+            << (wall > 0 ? frames / wall : 0) << " fps" << std::endl;
+  double tickUs = 0, renderUs = 0;
+  if (frames > 0) {
+    tickUs = Seconds(tickCounts) * 1e6 / frames;
+    renderUs = Seconds(renderCounts) * 1e6 / frames;
+  }
+  std::cout << "HEADLESS: tick " << tickUs << "us render " << renderUs
+            << "us per frame" << std::endl;
+  std::cout << "HEADLESS: state " << std::hex << GameStateHash(pGameState)
+            << " frames " << frameHash << std::dec << std::endl;
+
+  if (pApu) {
+    uint32_t audioHash = HashFrame(2166136261u, (const uint16_t *)audio.data(),
+                                   (int)audio.size());
+    std::cout << "HEADLESS: audio " << audio.size() / 2 << " frames hash "
+              << std::hex << audioHash << std::dec << std::endl;
+    WriteWav(wavFile, audio, AUDIO_RATE);
+    ApuDestroy(pApu);
+  }
+
+  if (pNet) {
+    NetStats stats;
+    NetGetStats(pNet, &stats);
+    std::cout << "NET: confirmed " << stats.confirmedTick << " of "
+              << stats.ticks << " ticks, " << stats.stalls << " stalls, "
+              << stats.rollbacks << " rollbacks resimulating "
+              << stats.resimulated << " ticks (longest " << stats.maxRollback
+              << " ticks, " << stats.maxRollbackMs << "ms), "
+              << stats.packetsSent << "/" << stats.packetsReceived
+              << " packets sent/received, " << stats.desyncs << " desyncs"
+              << std::endl;
+    std::cout << "NET: windows " << GameWindowsWon(pGameState, 0) << " / "
+              << GameWindowsWon(pGameState, 1) << std::endl;
+    NetDestroy(pNet);
+  }
+
+  if (pBroadcast) {
+    BroadcastStats stats;
+    BroadcastGetStats(pBroadcast, &stats);
+    // Per frame averages stay 0 if nothing was sent
+    double perFrame = 0, rawPerFrame = 0, encodeUs = 0, sendUs = 0;
+    if (stats.frames > 0) {
+      perFrame = (double)stats.bytesEncoded / stats.frames;
+      rawPerFrame = (double)stats.rawBytes / stats.frames;
+      encodeUs = stats.encodeSeconds * 1e6 / stats.frames;
+      sendUs = stats.sendSeconds * 1e6 / stats.frames;
+    }
+    std::cout << "BROADCAST: " << stats.frames << " frames, "
+              << stats.keyFrames << " key, " << perFrame
+              << " bytes per frame encoded (" << rawPerFrame
+              << " raw), " << stats.bytesSent << " bytes sent to "
+              << stats.viewers << " viewers, " << stats.viewersDropped
+              << " fell behind" << std::endl;
+    std::cout << "BROADCAST: encode " << encodeUs << "us send " << sendUs
+              << "us per frame, last frame " << std::hex
+              << HashFrame(2166136261u, pixs, GB_WIDTH * GB_HEIGHT)
+              << std::dec << std::endl;
+    BroadcastDestroy(pBroadcast);
+  }
+
+  if (pBot) {
+    uint64_t forks, ticks;
+    double searchSeconds;
+    BotGetStats(pBot, &forks, &ticks, &searchSeconds);
+    std::cout << "BOT: " << forks << " forks, " << ticks
+              << " ticks searched in " << searchSeconds << "s = "
+              << (searchSeconds > 0 ? forks / searchSeconds : 0)
+              << " forks/s, " << windowsEntered << " windows" << std::endl;
+    BotDestroy(pBot);
+  }
+
+  int result = 0;
+  if (pPlayer) {
+    if (ReplayDivergedTick(pPlayer) >= 0) {
+      std::cout << "HEADLESS: replay diverged at tick "
+                << ReplayDivergedTick(pPlayer) << std::endl;
+      result = 1;
+    }
+    ReplayPlayerDestroy(pPlayer);
+    InputLogDestroy(pLog);
+  } else {
+    GameDestroy(pGameState);
+  }
+
+  delete[] pixs;
+  delete[] tiles;
+  JobSystemDestroy(pJobs);
+  return result;
+}
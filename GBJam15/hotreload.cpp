@@ -0,0 +1,273 @@
+#include "hotreload.h"
+#include "collision.h"
+#include "gamestate.h"
+#include <string>
+#include <vector>
+#include <string.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#else
+#include <sys/stat.h>
+#endif
+
+struct AssetWatcher {
+  std::string spriteFile;
+  std::string floorFile;
+  GameAssets* pAssets;  // Newest
+
+  // Which sprite covers each pixel of the sheet, -1 for none
+  int sheetWidth, sheetHeight;
+  std::vector<int16_t> owner;
+
+#ifdef __linux__
+  int notifyFd;
+#else
+  time_t spriteTime, floorTime;
+#endif
+  WatcherStats stats;
+};
+
+#ifdef __linux__
+static const char* BaseName(const std::string& path) {
+  size_t slash = path.find_last_of("/\\");
+  return path.c_str() + ((slash == std::string::npos) ? 0 : slash + 1);
+}
+
+static std::string DirName(const std::string& path) {
+  size_t slash = path.find_last_of("/\\");
+  return (slash == std::string::npos) ? "." : path.substr(0, slash);
+}
+
+#else
+static time_t ModifiedTime(const std::string& path) {
+  struct stat st;
+  return (stat(path.c_str(), &st) == 0) ? st.st_mtime : 0;
+}
+#endif
+
+// nullptr unless it's an 8 bit sheet SliceSprites can read
+static SDL_Surface* LoadSheet(const std::string& filename) {
+  SDL_Surface* surf = SDL_LoadBMP(filename.c_str());
+  if (surf == nullptr) {
+    SDL_Log("Reload: %s", SDL_GetError());
+    return nullptr;
+  }
+  if ((surf->format->BitsPerPixel != 8) || (surf->pitch != surf->w)) {
+    SDL_Log("Reload: %s isn't an 8 bit sheet", filename.c_str());
+    SDL_FreeSurface(surf);
+    return nullptr;
+  }
+  return surf;
+}
+
+static void MapOwners(AssetWatcher& w) {
+  const ListOfRect& rects = w.pAssets->sprites.sprRect;
+  w.owner.assign(w.sheetWidth * w.sheetHeight, -1);
+  for (size_t i = 0; i < rects.size(); ++i) {
+    const Rect& r = rects[i];
+    for (int y = r.y; y < r.y + r.h; ++y) {
+      for (int x = r.x; x < r.x + r.w; ++x)
+        w.owner[x + y * w.sheetWidth] = (int16_t)i;
+    }
+  }
+}
+
+static void SliceSheet(AssetWatcher& w, SpriteData& sprites,
+                       SDL_Surface* surf) {
+  sprites = SpriteData();
+  SliceSprites(sprites, (const uint8_t*)surf->pixels, surf->w, surf->h);
+  w.sheetWidth = surf->w;
+  w.sheetHeight = surf->h;
+}
+
+// Sprites whose pixels differ, false if the edit could move a rect: it
+// touches a frame marker or a pixel outside every sprite
+static bool FindChangedSprites(const AssetWatcher& w, const uint8_t* oldPixs,
+                               const uint8_t* newPixs,
+                               std::vector<bool>& changed) {
+  uint8_t framePix = oldPixs[0];
+  if (newPixs[0] != framePix) return false;
+
+  for (int y = 0; y < w.sheetHeight; ++y) {
+    int row = y * w.sheetWidth;
+    if (memcmp(oldPixs + row, newPixs + row, w.sheetWidth) == 0) continue;
+    for (int x = 0; x < w.sheetWidth; ++x) {
+      uint8_t before = oldPixs[row + x];
+      uint8_t after = newPixs[row + x];
+      if (before == after) continue;
+      int sprID = w.owner[row + x];
+      if ((sprID < 0) || (before == framePix) || (after == framePix))
+        return false;
+      changed[sprID] = true;
+    }
+  }
+  return true;
+}
+
+// nullptr if it didn't load or nothing changed
+static GameAssets* ReloadSprites(AssetWatcher& w) {
+  SDL_Surface* surf = LoadSheet(w.spriteFile);
+  if (surf == nullptr) return nullptr;
+
+  GameAssets* pNew = new GameAssets(*w.pAssets);
+  SpriteData& sprites = pNew->sprites;
+  const uint8_t* newPixs = (const uint8_t*)surf->pixels;
+  std::vector<bool> changed(sprites.sprRect.size(), false);
+
+  bool isSameLayout = (surf->w == w.sheetWidth) &&
+                      (surf->h == w.sheetHeight) &&
+                      FindChangedSprites(w, w.pAssets->sprites.pixs, newPixs,
+                                         changed);
+  int numChanged = 0;
+  if (isSameLayout) {
+    for (size_t i = 0; i < changed.size(); ++i) numChanged += changed[i];
+    if (numChanged == 0) {
+      SDL_FreeSurface(surf);
+      delete pNew;
+      return nullptr;
+    }
+
+    // Same rects, new pixels, masks redone where they changed
+    uint8_t* pixs = new uint8_t[surf->w * surf->h];
+    memcpy(pixs, newPixs, surf->w * surf->h);
+    sprites.pixs = pixs;
+    for (size_t i = 0; i < changed.size(); ++i) {
+      if (changed[i]) BuildSpriteMask(sprites, (int)i);
+    }
+  } else {
+    SliceSheet(w, sprites, surf);
+    numChanged = (int)sprites.sprRect.size();
+    w.stats.fullSlices++;
+  }
+  SDL_FreeSurface(surf);
+
+  // Keep the old art rather than draw nothing for the missing sprites
+  if (!GameFinishAssets(pNew)) {
+    SDL_Log("Reload: %s kept", w.spriteFile.c_str());
+    delete[] pNew->sprites.pixs;
+    delete pNew;
+    return nullptr;
+  }
+  w.stats.spritesChanged = numChanged;
+  if (!isSameLayout) {
+    w.pAssets = pNew;
+    MapOwners(w);
+  }
+  return pNew;
+}
+
+static GameAssets* ReloadFloor(AssetWatcher& w) {
+  BackgroundData floor = {nullptr, Rect{0, 0, 0, 0}};
+  SetupBackground(floor, w.floorFile.c_str());
+  if (floor.pixs == nullptr) return nullptr;
+
+  GameAssets* pNew = new GameAssets(*w.pAssets);
+  pNew->floor = floor;
+  return pNew;
+}
+
+AssetWatcher* WatcherCreate(const char* spriteFile, const char* floorFile) {
+  SDL_Surface* surf = LoadSheet(spriteFile);
+  if (surf == nullptr) return nullptr;
+
+  AssetWatcher* pWatcher = new AssetWatcher();
+  AssetWatcher& w = *pWatcher;
+  w.spriteFile = spriteFile;
+  w.floorFile = floorFile;
+  w.pAssets = new GameAssets();
+  SliceSheet(w, w.pAssets->sprites, surf);
+  SDL_FreeSurface(surf);
+  SetupBackground(w.pAssets->floor, floorFile);
+  if (!GameFinishAssets(w.pAssets)) {
+    GameAssetsDestroy(w.pAssets);
+    delete pWatcher;
+    return nullptr;
+  }
+  MapOwners(w);
+  memset(&w.stats, 0, sizeof(w.stats));
+
+#ifdef __linux__
+  // Directories not files, editors often save by renaming over the old one
+  w.notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (w.notifyFd >= 0) {
+    uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO;
+    inotify_add_watch(w.notifyFd, DirName(w.spriteFile).c_str(), mask);
+    inotify_add_watch(w.notifyFd, DirName(w.floorFile).c_str(), mask);
+  } else {
+    SDL_Log("Reload: inotify unavailable, no reloading");
+  }
+#else
+  w.spriteTime = ModifiedTime(w.spriteFile);
+  w.floorTime = ModifiedTime(w.floorFile);
+#endif
+  return pWatcher;
+}
+
+void WatcherDestroy(AssetWatcher* pWatcher) {
+  if (pWatcher == nullptr) return;
+#ifdef __linux__
+  if (pWatcher->notifyFd >= 0) close(pWatcher->notifyFd);
+#endif
+  delete pWatcher;
+}
+
+const GameAssets* WatcherAssets(AssetWatcher* pWatcher) {
+  return pWatcher->pAssets;
+}
+
+const GameAssets* WatcherPoll(AssetWatcher* pWatcher) {
+  AssetWatcher& w = *pWatcher;
+  bool isSpriteSaved = false, isFloorSaved = false;
+
+#ifdef __linux__
+  if (w.notifyFd < 0) return nullptr;
+  alignas(inotify_event) char buf[4096];
+  for (;;) {
+    ssize_t n = read(w.notifyFd, buf, sizeof(buf));
+    if (n <= 0) break;
+    for (char* p = buf; p < buf + n;) {
+      const inotify_event* pEvent = (const inotify_event*)p;
+      if (pEvent->len > 0) {
+        isSpriteSaved = isSpriteSaved ||
+                        (strcmp(pEvent->name, BaseName(w.spriteFile)) == 0);
+        isFloorSaved = isFloorSaved ||
+                       (strcmp(pEvent->name, BaseName(w.floorFile)) == 0);
+      }
+      p += sizeof(inotify_event) + pEvent->len;
+    }
+  }
+#else
+  time_t spriteTime = ModifiedTime(w.spriteFile);
+  time_t floorTime = ModifiedTime(w.floorFile);
+  isSpriteSaved = spriteTime != w.spriteTime;
+  isFloorSaved = floorTime != w.floorTime;
+  w.spriteTime = spriteTime;
+  w.floorTime = floorTime;
+#endif
+  if (!isSpriteSaved && !isFloorSaved) return nullptr;
+
+  Uint64 start = SDL_GetPerformanceCounter();
+  const GameAssets* pBefore = w.pAssets;
+  w.stats.spritesChanged = 0;
+  if (isSpriteSaved) {
+    GameAssets* pNew = ReloadSprites(w);
+    if (pNew) w.pAssets = pNew;
+  }
+  if (isFloorSaved) {
+    GameAssets* pNew = ReloadFloor(w);
+    if (pNew) w.pAssets = pNew;
+  }
+  if (w.pAssets == pBefore) return nullptr;
+
+  w.stats.reloads++;
+  w.stats.lastReloadMs = (double)(SDL_GetPerformanceCounter() - start) *
+                         1000.0 / (double)SDL_GetPerformanceFrequency();
+  SDL_Log("Reload: %d sprites changed, %.2fms", w.stats.spritesChanged,
+          w.stats.lastReloadMs);
+  return w.pAssets;
+}
+
+void WatcherGetStats(AssetWatcher* pWatcher, WatcherStats* pStats) {
+  *pStats = pWatcher->stats;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Dev mode art reloading. Watches the sprite sheet and floor for saves
+// (inotify on Linux, modification times elsewhere) and builds new
+// GameAssets from the old ones for the caller to point its games at
+// between frames. An edit inside existing sprites that leaves the frame
+// markers alone keeps every rect and only redoes the masks of the sprites
+// it touched, anything else slices the sheet again. Assets are never
+// freed, forks and render snapshots may still be drawing with old ones.
+struct AssetWatcher;
+
+struct WatcherStats {
+  int reloads;
+  int fullSlices;       // Reloads that had to find the sprites again
+  int spritesChanged;   // By the last reload
+  double lastReloadMs;  // Load to new assets ready
+};
+
+// Loads the files itself, nullptr if they can't be
+AssetWatcher* WatcherCreate(const char* spriteFile, const char* floorFile);
+void WatcherDestroy(AssetWatcher* pWatcher);
+
+// The newest assets
+const GameAssets* WatcherAssets(AssetWatcher* pWatcher);
+
+// Never blocks. New assets if a file was saved since the last call, else
+// nullptr. A file that fails to load (half written) is tried again on its
+// next save.
+const GameAssets* WatcherPoll(AssetWatcher* pWatcher);
+
+void WatcherGetStats(AssetWatcher* pWatcher, WatcherStats* pStats);
+};
@@ -0,0 +1,339 @@
+#include "jobs.h"
+#include "SDL.h"
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <condition_variable>
+
+#ifdef _MSC_VER
+#define JOB_THREAD_LOCAL __declspec(thread)
+#else
+#define JOB_THREAD_LOCAL __thread
+#endif
+
+static const int JOB_POOL_SIZE = 4096;   // Power of 2
+static const int JOB_DEQUE_SIZE = 1024;  // Power of 2
+static const int MAX_CONTINUATIONS = 8;
+
+struct Job {
+  JobFunc func;
+  JobRangeFunc rangeFunc;
+  void* pData;
+  int begin;
+  int end;
+  int grain;
+
+  Job* pParent;
+  std::atomic<int> unfinished;   // Itself plus children still running
+  std::atomic<int> pendingDeps;  // Dependencies left, +1 until submitted
+  Job* continuations[MAX_CONTINUATIONS];
+  int numContinuations;
+};
+
+// Chase-Lev deque, the owner pushes and pops the bottom, thieves take the top
+struct JobDeque {
+  std::atomic<Job*> jobs[JOB_DEQUE_SIZE];
+  std::atomic<int64_t> top;
+  std::atomic<int64_t> bottom;
+};
+
+struct JobSystem {
+  Job pool[JOB_POOL_SIZE];
+  std::atomic<uint32_t> nextJob;
+
+  int numThreads;
+  JobDeque* deques;
+  std::vector<std::thread> workers;
+
+  // Jobs submitted from threads without a deque
+  std::mutex injectLock;
+  std::deque<Job*> injected;
+  std::atomic<int> numInjected;
+
+  // Idle workers sleep until something is queued
+  std::mutex sleepLock;
+  std::condition_variable sleepWake;
+  std::atomic<int> queued;
+  std::atomic<int> sleeping;
+  std::atomic<bool> quit;
+};
+
+static JOB_THREAD_LOCAL JobSystem* s_pOwner = nullptr;
+static JOB_THREAD_LOCAL int s_threadIndex = -1;
+
+static int ThreadIndex(JobSystem* pJobs) {
+  return (s_pOwner == pJobs) ? s_threadIndex : -1;
+}
+
+/////// DEQUE
+
+static bool DequePush(JobDeque& dq, Job* pJob) {
+  int64_t b = dq.bottom.load(std::memory_order_relaxed);
+  int64_t t = dq.top.load(std::memory_order_acquire);
+  if (b - t >= JOB_DEQUE_SIZE) return false;
+
+  dq.jobs[b & (JOB_DEQUE_SIZE - 1)].store(pJob, std::memory_order_relaxed);
+  dq.bottom.store(b + 1, std::memory_order_release);
+  return true;
+}
+
+static Job* DequePop(JobDeque& dq) {
+  int64_t b = dq.bottom.load(std::memory_order_relaxed) - 1;
+  dq.bottom.store(b, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t t = dq.top.load(std::memory_order_relaxed);
+
+  if (t > b) {
+    dq.bottom.store(b + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  Job* pJob = dq.jobs[b & (JOB_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+  if (t == b) {
+    // Last one, race the thieves for it
+    if (!dq.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+      pJob = nullptr;
+    }
+    dq.bottom.store(b + 1, std::memory_order_relaxed);
+  }
+  return pJob;
+}
+
+static Job* DequeSteal(JobDeque& dq) {
+  int64_t t = dq.top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  int64_t b = dq.bottom.load(std::memory_order_acquire);
+  if (t >= b) return nullptr;
+
+  Job* pJob = dq.jobs[t & (JOB_DEQUE_SIZE - 1)].load(std::memory_order_relaxed);
+  if (!dq.top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+    return nullptr;
+  }
+  return pJob;
+}
+
+/////// SCHEDULING
+
+static void ExecuteJob(JobSystem* pJobs, Job* pJob);
+
+static void PushJob(JobSystem* pJobs, Job* pJob) {
+  int idx = ThreadIndex(pJobs);
+  if (idx >= 0) {
+    if (!DequePush(pJobs->deques[idx], pJob)) {
+      ExecuteJob(pJobs, pJob);  // Deque full, just run it
+      return;
+    }
+  } else {
+    std::lock_guard<std::mutex> guard(pJobs->injectLock);
+    pJobs->injected.push_back(pJob);
+    ++pJobs->numInjected;
+  }
+
+  ++pJobs->queued;
+  if (pJobs->sleeping > 0) {
+    std::lock_guard<std::mutex> guard(pJobs->sleepLock);
+    pJobs->sleepWake.notify_one();
+  }
+}
+
+static Job* TakeJob(JobSystem* pJobs) {
+  int idx = ThreadIndex(pJobs);
+  Job* pJob = nullptr;
+
+  if (idx >= 0) pJob = DequePop(pJobs->deques[idx]);
+
+  if ((pJob == nullptr) && (pJobs->numInjected > 0)) {
+    std::lock_guard<std::mutex> guard(pJobs->injectLock);
+    if (!pJobs->injected.empty()) {
+      pJob = pJobs->injected.front();
+      pJobs->injected.pop_front();
+      --pJobs->numInjected;
+    }
+  }
+
+  // Steal from the others, starting with our neighbour
+  for (int i = 1; (pJob == nullptr) && (i <= pJobs->numThreads); ++i) {
+    int victim = (idx + i + pJobs->numThreads) % pJobs->numThreads;
+    if (victim != idx) pJob = DequeSteal(pJobs->deques[victim]);
+  }
+
+  if (pJob) --pJobs->queued;
+  return pJob;
+}
+
+static void ReleaseDependent(JobSystem* pJobs, Job* pJob) {
+  if (--pJob->pendingDeps == 0) PushJob(pJobs, pJob);
+}
+
+static void FinishJob(JobSystem* pJobs, Job* pJob) {
+  // Copy out first, waiters may move on the moment unfinished hits 0
+  Job* pParent = pJob->pParent;
+  int numContinuations = pJob->numContinuations;
+  Job* continuations[MAX_CONTINUATIONS];
+  for (int i = 0; i < numContinuations; ++i) {
+    continuations[i] = pJob->continuations[i];
+  }
+
+  if (--pJob->unfinished != 0) return;
+
+  for (int i = 0; i < numContinuations; ++i) {
+    ReleaseDependent(pJobs, continuations[i]);
+  }
+  if (pParent) FinishJob(pJobs, pParent);
+}
+
+static Job* AllocJob(JobSystem* pJobs) {
+  uint32_t idx = pJobs->nextJob++ & (JOB_POOL_SIZE - 1);
+  Job* pJob = &pJobs->pool[idx];
+  pJob->func = nullptr;
+  pJob->rangeFunc = nullptr;
+  pJob->pData = nullptr;
+  pJob->begin = 0;
+  pJob->end = 0;
+  pJob->grain = 1;
+  pJob->pParent = nullptr;
+  pJob->unfinished = 1;
+  pJob->pendingDeps = 1;
+  pJob->numContinuations = 0;
+  return pJob;
+}
+
+static void ExecuteJob(JobSystem* pJobs, Job* pJob) {
+  if (pJob->rangeFunc) {
+    // Hand off the top half until the rest is one grain, thieves take
+    // the biggest pieces first
+    int begin = pJob->begin;
+    int end = pJob->end;
+    while ((end - begin) > pJob->grain) {
+      int mid = begin + (end - begin) / 2;
+      Job* pChild = AllocJob(pJobs);
+      pChild->rangeFunc = pJob->rangeFunc;
+      pChild->pData = pJob->pData;
+      pChild->begin = mid;
+      pChild->end = end;
+      pChild->grain = pJob->grain;
+      pChild->pParent = pJob;
+      ++pJob->unfinished;
+      JobSubmit(pJobs, pChild);
+      end = mid;
+    }
+    if (end > begin) pJob->rangeFunc(pJob->pData, begin, end);
+  } else if (pJob->func) {
+    pJob->func(pJob->pData);
+  }
+
+  FinishJob(pJobs, pJob);
+}
+
+static void JobWorker(JobSystem* pJobs, int idx) {
+  s_pOwner = pJobs;
+  s_threadIndex = idx;
+
+  while (!pJobs->quit) {
+    Job* pJob = TakeJob(pJobs);
+    if (pJob) {
+      ExecuteJob(pJobs, pJob);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> guard(pJobs->sleepLock);
+    ++pJobs->sleeping;
+    pJobs->sleepWake.wait(
+        guard, [&] { return pJobs->quit || (pJobs->queued > 0); });
+    --pJobs->sleeping;
+  }
+}
+
+/////// API
+
+JobSystem* JobSystemCreate(int numThreads) {
+  if (numThreads <= 0) numThreads = SDL_GetCPUCount();
+  if (numThreads < 1) numThreads = 1;
+
+  JobSystem* pJobs = new JobSystem();
+  pJobs->nextJob = 0;
+  pJobs->numThreads = numThreads;
+  pJobs->deques = new JobDeque[numThreads];
+  for (int i = 0; i < numThreads; ++i) {
+    pJobs->deques[i].top = 0;
+    pJobs->deques[i].bottom = 0;
+  }
+  pJobs->numInjected = 0;
+  pJobs->queued = 0;
+  pJobs->sleeping = 0;
+  pJobs->quit = false;
+
+  // Calling thread is thread 0
+  s_pOwner = pJobs;
+  s_threadIndex = 0;
+  for (int i = 1; i < numThreads; ++i) {
+    pJobs->workers.push_back(std::thread(JobWorker, pJobs, i));
+  }
+
+  return pJobs;
+}
+
+void JobSystemDestroy(JobSystem* pJobs) {
+  {
+    std::lock_guard<std::mutex> guard(pJobs->sleepLock);
+    pJobs->quit = true;
+  }
+  pJobs->sleepWake.notify_all();
+  for (size_t i = 0; i < pJobs->workers.size(); ++i) pJobs->workers[i].join();
+
+  if (s_pOwner == pJobs) s_pOwner = nullptr;
+  delete[] pJobs->deques;
+  delete pJobs;
+}
+
+int JobSystemNumThreads(JobSystem* pJobs) { return pJobs->numThreads; }
+
+Job* JobCreate(JobSystem* pJobs, JobFunc func, void* pData) {
+  Job* pJob = AllocJob(pJobs);
+  pJob->func = func;
+  pJob->pData = pData;
+  return pJob;
+}
+
+Job* JobCreateRange(JobSystem* pJobs, JobRangeFunc func, void* pData,
+                    int begin, int end, int grain) {
+  Job* pJob = AllocJob(pJobs);
+  pJob->rangeFunc = func;
+  pJob->pData = pData;
+  pJob->begin = begin;
+  pJob->end = end;
+  pJob->grain = (grain < 1) ? 1 : grain;
+  return pJob;
+}
+
+void JobAddDependency(Job* pJob, Job* pBefore) {
+  SDL_assert(pBefore->numContinuations < MAX_CONTINUATIONS);
+  pBefore->continuations[pBefore->numContinuations++] = pJob;
+  ++pJob->pendingDeps;
+}
+
+void JobSubmit(JobSystem* pJobs, Job* pJob) { ReleaseDependent(pJobs, pJob); }
+
+void JobWait(JobSystem* pJobs, Job* pJob) {
+  while (!JobIsDone(pJob)) {
+    Job* pOther = TakeJob(pJobs);
+    if (pOther)
+      ExecuteJob(pJobs, pOther);
+    else
+      std::this_thread::yield();
+  }
+}
+
+bool JobIsDone(Job* pJob) { return pJob->unfinished == 0; }
+
+void JobParallelFor(JobSystem* pJobs, JobRangeFunc func, void* pData,
+                    int begin, int end, int grain) {
+  Job* pJob = JobCreateRange(pJobs, func, pData, begin, end, grain);
+  JobSubmit(pJobs, pJob);
+  JobWait(pJobs, pJob);
+}
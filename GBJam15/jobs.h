@@ -0,0 +1,39 @@
+#pragma once
+
+extern "C" {
+
+// Work-stealing job system, one deque per thread, idle threads steal.
+// The creating thread is thread 0 and runs jobs while it waits, other
+// threads can submit and wait too (their jobs go through a shared queue).
+struct JobSystem;
+struct Job;
+
+typedef void (*JobFunc)(void* pData);
+typedef void (*JobRangeFunc)(void* pData, int begin, int end);
+
+// numThreads includes the caller, <= 0 uses every core
+JobSystem* JobSystemCreate(int numThreads);
+void JobSystemDestroy(JobSystem* pJobs);
+int JobSystemNumThreads(JobSystem* pJobs);
+
+// Jobs come from a ring pool, a handle stays valid for the next 4095 jobs
+Job* JobCreate(JobSystem* pJobs, JobFunc func, void* pData);
+
+// Splits [begin, end) in halves down to grain sized ranges, each one a job
+Job* JobCreateRange(JobSystem* pJobs, JobRangeFunc func, void* pData,
+                    int begin, int end, int grain);
+
+// pJob waits for pBefore, call before submitting either of them
+void JobAddDependency(Job* pJob, Job* pBefore);
+
+// Runs once every dependency is done
+void JobSubmit(JobSystem* pJobs, Job* pJob);
+
+// Runs other jobs until pJob and everything it spawned is done
+void JobWait(JobSystem* pJobs, Job* pJob);
+bool JobIsDone(Job* pJob);
+
+// Create, submit and wait for a range job
+void JobParallelFor(JobSystem* pJobs, JobRangeFunc func, void* pData,
+                    int begin, int end, int grain);
+};
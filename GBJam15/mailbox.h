@@ -0,0 +1,40 @@
+#pragma once
+#include <atomic>
+
+// Lock-free single producer / single consumer "latest value" mailbox.
+// Three slots: the producer fills its back slot and swaps it with the
+// middle one, the consumer swaps its front slot with the middle one when
+// something new is there. Neither side ever waits on the other, older
+// unread values are overwritten.
+template <typename T>
+class Mailbox {
+ public:
+  Mailbox() : m_back(0), m_front(1), m_middle(2) {}
+
+  T& Back() { return m_slots[m_back]; }
+  T& Front() { return m_slots[m_front]; }
+  T& Slot(int i) { return m_slots[i]; }
+
+  // Returns false if the previous value was never read (dropped)
+  bool Publish() {
+    int prev = m_middle.exchange(m_back | DIRTY, std::memory_order_acq_rel);
+    m_back = prev & INDEX_MASK;
+    return (prev & DIRTY) == 0;
+  }
+
+  // Returns false if nothing new, Front() is unchanged
+  bool Fetch() {
+    if ((m_middle.load(std::memory_order_acquire) & DIRTY) == 0) return false;
+    m_front = m_middle.exchange(m_front, std::memory_order_acq_rel) & INDEX_MASK;
+    return true;
+  }
+
+ private:
+  static const int INDEX_MASK = 3;
+  static const int DIRTY = 4;
+
+  T m_slots[3];
+  int m_back;   // Producer only
+  int m_front;  // Consumer only
+  std::atomic<int> m_middle;
+};
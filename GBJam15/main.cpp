@@ -1,8 +1,23 @@
 #include "SDL.h"
 #include <iostream>
+#include <atomic>
+#include <thread>
+#include <string.h>
+#include <stdlib.h>
 
+#include "apu.h"
+#include "atlas.h"
+#include "broadcast.h"
 #include "cat.h"
 #include "gif.h"
+#include "hotreload.h"
+#include "netplay.h"
+#include "replay.h"
+#include "rewind.h"
+#include "mailbox.h"
+#include "jobs.h"
+#include "spscring.h"
+#include "tiles.h"
 
 #define SCREEN_TITLE "GBJam #15 - Kimau"
 
@@ -30,18 +45,102 @@ void Error(const char *msg) {
 struct SDLAPP {
   SDL_Window *m_window;
   SDL_Renderer *m_renderer;
-};
+  JobSystem *pJobs;
+
+  // Game
+  ButState buttons;
+  GameStateData *pGameState;
+  RewindBuffer *pRewind;
+  bool isRewinding;
+  NetSession *pNet;  // Two player over UDP, no rewind or recording
+  BroadcastServer *pBroadcast;  // Spectators, fed every captured frame
+  AssetWatcher *pWatcher;       // Art reloading, see -hotreload
+
+  // Capture, the GIF is only touched by whichever thread renders
+  std::atomic<bool> wantRecording;
+  bool isRecording;
+  GifWriter writer;
+  uint8_t *decomGif;
+
+  // Frames drawn in 8x8 tiles (-tiled), made linear when presented and
+  // captured
+  bool isTiled;
+  uint16_t *captureLinear;
+  InputLog *pInputLog;
+  const char *replayFile;
+
+  // Pipelined rendering
+  bool isPipelined;
+  std::thread renderThread;
+  std::atomic<bool> quitRender;
+  SDL_sem *renderWake;
+  Mailbox<GameStateData *> snapshots;
+
+  // Present thread, owns m_renderer and shows the newest finished frame
+  std::thread presentThread;
+  std::atomic<bool> quitPresent;
+  SDL_sem *presentWake;
+  Mailbox<uint16_t *> frames;
+  std::atomic<uint64_t> framesPresented;
+  std::atomic<uint64_t> framesDropped;     // Finished but never shown
+  std::atomic<uint64_t> framesDuplicated;  // Refresh with nothing new
+
+  // Audio, the game thread synthesizes and the device callback only copies
+  Apu *pApu;
+  SDL_AudioDeviceID audioDevice;
+  SpscRing<int16_t, 4096> audioRing;  // Interleaved stereo
+  std::atomic<uint64_t> audioUnderruns;
 
-bool isRecording = false;
-GifWriter writer;
+  // Idle, frames that wouldn't change are skipped and the game pauses in
+  // the background
+  bool isFocused;
+  bool isMinimized;
+  bool isPaused;
+  std::atomic<bool> isIdle;  // Nothing new to show, the presenter rests
+  uint32_t lastRenderKey;
+  uint64_t framesSkipped;
+};
 
 SDLAPP *CreateApp() {
-  if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+  if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) != 0) {
     Error("SDL_Init");
     return nullptr;
   }
 
   SDLAPP *pApp = new SDLAPP();
+  pApp->buttons = {0, 0, 0, 0};
+  pApp->pJobs = nullptr;
+  pApp->pGameState = nullptr;
+  pApp->pRewind = nullptr;
+  pApp->isRewinding = false;
+  pApp->pNet = nullptr;
+  pApp->pBroadcast = nullptr;
+  pApp->pWatcher = nullptr;
+  pApp->wantRecording = false;
+  pApp->isRecording = false;
+  pApp->decomGif = new uint8_t[GB_HEIGHT * GB_WIDTH * 4];
+  pApp->isTiled = false;
+  pApp->captureLinear = new uint16_t[GB_WIDTH * GB_HEIGHT];
+  pApp->pInputLog = nullptr;
+  pApp->replayFile = nullptr;
+  pApp->isPipelined = false;
+  pApp->quitRender = false;
+  pApp->renderWake = nullptr;
+  pApp->m_renderer = nullptr;
+  pApp->quitPresent = false;
+  pApp->presentWake = nullptr;
+  pApp->framesPresented = 0;
+  pApp->framesDropped = 0;
+  pApp->framesDuplicated = 0;
+  pApp->pApu = nullptr;
+  pApp->audioDevice = 0;
+  pApp->audioUnderruns = 0;
+  pApp->isFocused = true;
+  pApp->isMinimized = false;
+  pApp->isPaused = false;
+  pApp->isIdle = false;
+  pApp->lastRenderKey = 0;
+  pApp->framesSkipped = 0;
   pApp->m_window = SDL_CreateWindow(SCREEN_TITLE, 100, 100, SCREEN_WIDTH,
                                     SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
   if (pApp->m_window == nullptr) {
@@ -50,20 +149,42 @@ SDLAPP *CreateApp() {
     return nullptr;
   }
 
-  pApp->m_renderer = SDL_CreateRenderer(
-      pApp->m_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
-  if (pApp->m_renderer == nullptr) {
-    Error("SDL_CreateRenderer");
-    SDL_DestroyWindow(pApp->m_window);
-    delete pApp;
-    return nullptr;
-  }
-
   return pApp;
 }
 
 void CleanQuit(SDLAPP *pApp) {
-  SDL_DestroyRenderer(pApp->m_renderer);
+  if (pApp->pInputLog) {
+    InputLogSave(pApp->pInputLog, pApp->replayFile);
+    InputLogDestroy(pApp->pInputLog);
+  }
+  if (pApp->pRewind) RewindDestroy(pApp->pRewind);
+  if (pApp->pNet) {
+    NetStats stats;
+    NetGetStats(pApp->pNet, &stats);
+    std::cout << "LOG:Net rollbacks " << stats.rollbacks << " resimulated "
+              << stats.resimulated << " longest " << stats.maxRollbackMs
+              << "ms stalls " << stats.stalls << " desyncs " << stats.desyncs
+              << std::endl;
+    NetDestroy(pApp->pNet);
+  }
+  if (pApp->pBroadcast) {
+    BroadcastStats stats;
+    BroadcastGetStats(pApp->pBroadcast, &stats);
+    std::cout << "LOG:Broadcast " << stats.frames << " frames "
+              << stats.bytesEncoded << " bytes encoded "
+              << stats.bytesSent << " sent" << std::endl;
+    BroadcastDestroy(pApp->pBroadcast);
+  }
+  if (pApp->pWatcher) {
+    WatcherStats stats;
+    WatcherGetStats(pApp->pWatcher, &stats);
+    std::cout << "LOG:Reloaded art " << stats.reloads << " times, "
+              << stats.fullSlices << " full, last took "
+              << stats.lastReloadMs << "ms" << std::endl;
+    WatcherDestroy(pApp->pWatcher);
+  }
+  if (pApp->pJobs) JobSystemDestroy(pApp->pJobs);
+
   SDL_DestroyWindow(pApp->m_window);
   SDL_Quit();
 }
@@ -81,33 +202,116 @@ void RenderTestScene(uint16_t *pixs, SDL_Rect srcRect) {
   }
 }
 
-const Uint32 s_FrameRate = 1000 / 30;
-static SDL_Event s_event;
-static Uint32 start_time = SDL_GetTicks();
-static ButState buttons;
-static GameStateData *pGameState = NULL;
+const Uint64 TICK_RATE = 30;
+const Uint32 s_FrameRate = 1000 / TICK_RATE;
+const int MAX_CATCHUP_TICKS = 5;
+const Uint64 SLEEP_MARGIN_MS = 2;
+const int REPLAY_KEYFRAME_TICKS = 30 * 10;
+const size_t REWIND_BUDGET_BYTES = 4 * 1024 * 1024;
+
+// Audio queued ahead of the device stays under TARGET + DEVICE frames, about
+// 15ms, so the loop wakes every AUDIO_PUMP_MS to top it up
+const int AUDIO_RATE = 48000;
+const int AUDIO_DEVICE_FRAMES = 256;
+const int AUDIO_BLOCK_FRAMES = 128;
+const int AUDIO_TARGET_FRAMES = 480;
+const Uint32 AUDIO_PUMP_MS = 4;
+
+// Paused in the background the loop blocks on events, waking this often
+const int IDLE_WAIT_MS = 1000;
+
+// Fixed timestep pacing. Deadlines are computed from the origin rather than
+// accumulated so the integer tick length never drifts.
+struct FramePacer {
+  Uint64 freq;
+  Uint64 origin;
+  Uint64 ticks;  // Deadlines consumed since origin
+  bool isRelaxed;  // Idle, sleep through the spin margin too
+
+  // Stats
+  Uint64 totalTicks;
+  Uint64 lateFrames;
+  Uint64 droppedTicks;
+};
+
+void PacerReset(FramePacer &pacer) {
+  pacer.freq = SDL_GetPerformanceFrequency();
+  pacer.origin = SDL_GetPerformanceCounter();
+  pacer.ticks = 0;
+  pacer.isRelaxed = false;
+  pacer.totalTicks = 0;
+  pacer.lateFrames = 0;
+  pacer.droppedTicks = 0;
+}
+
+// Carry on from now as if no time had passed, e.g. after a pause
+void PacerResume(FramePacer &pacer) {
+  pacer.origin = SDL_GetPerformanceCounter();
+  pacer.ticks = 0;
+}
+
+Uint64 PacerDeadline(const FramePacer &pacer) {
+  return pacer.origin + (pacer.ticks * pacer.freq) / TICK_RATE;
+}
+
+// Sleep most of the way then spin, SDL_Delay alone can overshoot by a ms.
+// Gives up after maxMs so the caller can do some work, false if it did.
+bool PacerWait(const FramePacer &pacer, Uint32 maxMs) {
+  Uint64 deadline = PacerDeadline(pacer);
+  Uint64 margin = pacer.isRelaxed ? 0 : pacer.freq * SLEEP_MARGIN_MS / 1000;
+  Uint64 giveUp = SDL_GetPerformanceCounter() + pacer.freq * maxMs / 1000;
+  for (;;) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= deadline) return true;
+    if (now >= giveUp) return false;
 
-int GameStep() {
-  start_time = SDL_GetTicks();
+    Uint64 wake = (deadline > margin) ? (deadline - margin) : 0;
+    if (wake > giveUp) wake = giveUp;
+    if (wake > now) SDL_Delay((Uint32)((wake - now) * 1000 / pacer.freq));
+  }
+}
+
+int PollEvents(SDLAPP *pApp) {
+  SDL_Event event;
+  ButState &buttons = pApp->buttons;
 
   // Events
-  while (SDL_PollEvent(&s_event)) {
-    switch (s_event.type) {
+  while (SDL_PollEvent(&event)) {
+    switch (event.type) {
       case SDL_WINDOWEVENT:
         // if (event.window.windowID == windowID)
-        switch (s_event.window.event) {
+        switch (event.window.event) {
           case SDL_WINDOWEVENT_CLOSE: {
             Log("Event: Close Window");
             break;
           }
+          case SDL_WINDOWEVENT_FOCUS_GAINED:
+            pApp->isFocused = true;
+            break;
+          case SDL_WINDOWEVENT_FOCUS_LOST:
+            // Key ups go elsewhere now, let go of everything
+            pApp->isFocused = false;
+            buttons = ButState{0, 0, 0, 0};
+            pApp->isRewinding = false;
+            break;
+          case SDL_WINDOWEVENT_MINIMIZED:
+          case SDL_WINDOWEVENT_HIDDEN:
+            pApp->isMinimized = true;
+            break;
+          case SDL_WINDOWEVENT_RESTORED:
+          case SDL_WINDOWEVENT_SHOWN:
+            pApp->isMinimized = false;
+            break;
         }
         break;
 
       case SDL_MOUSEBUTTONUP:
-        DebugPt(pGameState, Pt{s_event.button.x / 3, s_event.button.y / 3});
+        if (pApp->pGameState)
+          DebugPt(pApp->pGameState,
+                  Pt{event.button.x / 3, event.button.y / 3});
 
       case SDL_KEYDOWN:
-        switch (s_event.key.keysym.scancode) {
+        switch (event.key.keysym.scancode) {
           case SDL_SCANCODE_UP:
             buttons.up = 3;
             break;
@@ -120,11 +324,14 @@ int GameStep() {
           case SDL_SCANCODE_RIGHT:
             buttons.right = 3;
             break;
+          case SDL_SCANCODE_R:
+            pApp->isRewinding = true;
+            break;
         }
         break;
 
       case SDL_KEYUP:
-        switch (s_event.key.keysym.scancode) {
+        switch (event.key.keysym.scancode) {
           case SDL_SCANCODE_UP:
             buttons.up = 0;
             break;
@@ -137,15 +344,11 @@ int GameStep() {
           case SDL_SCANCODE_RIGHT:
             buttons.right = 0;
             break;
+          case SDL_SCANCODE_R:
+            pApp->isRewinding = false;
+            break;
           case SDL_SCANCODE_G:
-            if (isRecording) {
-              isRecording = false;
-              GifEnd(&writer);
-            } else {
-              isRecording = true;
-              writer.firstFrame = true;
-              GifBegin(&writer, "cat.gif", GB_WIDTH, GB_HEIGHT, s_FrameRate);
-            }
+            pApp->wantRecording = !pApp->wantRecording;
         }
         break;
 
@@ -154,72 +357,667 @@ int GameStep() {
         return 0;
 
       default:
-        Log("Event: ");  // %d", s_event.type);  // Event Spam
+        Log("Event: ");  // %d", event.type);  // Event Spam
     }
 
     // TODO :: Handle Event
   }
 
+  return 1;
+}
+
+void GameStep(SDLAPP *pApp) {
+  ButState &buttons = pApp->buttons;
+
+  // Two player, a tick is skipped while waiting on the other side
+  if (pApp->pNet) {
+    NetAdvance(pApp->pNet, &buttons);
+    return;
+  }
+
+  // Rewind, the recording follows the timeline we end up on
+  if (pApp->isRewinding) {
+    if (RewindPop(pApp->pRewind, pApp->pGameState) && pApp->pInputLog)
+      InputLogTruncate(pApp->pInputLog,
+                       InputLogNumTicks(pApp->pInputLog) - 1);
+    return;
+  }
+
   // Update
-  Tick(pGameState, &buttons);
+  ButState tickButtons = buttons;
+  Tick(pApp->pGameState, &buttons);
+  RewindPush(pApp->pRewind, pApp->pGameState);
 
-  return 1;
+  if (pApp->pInputLog)
+    InputLogRecord(pApp->pInputLog, &tickButtons, pApp->pGameState);
 }
 
-uint8_t *decomGif;
+// Device thread, only copies out of the ring, silence if it ran dry
+void AudioCallback(void *pData, Uint8 *stream, int len) {
+  SDLAPP *pApp = (SDLAPP *)pData;
+  int16_t *out = (int16_t *)stream;
+  int count = len / (int)sizeof(int16_t);
+  int got = pApp->audioRing.Pop(out, count);
+  if (got < count) {
+    memset(out + got, 0, (count - got) * sizeof(int16_t));
+    ++pApp->audioUnderruns;
+  }
+}
+
+// Game thread, synthesizes blocks until the ring is AUDIO_TARGET_FRAMES ahead
+void PumpAudio(SDLAPP *pApp) {
+  if (pApp->pApu == nullptr) return;
+
+  int16_t block[AUDIO_BLOCK_FRAMES * 2];
+  while ((pApp->audioRing.Size() / 2 + AUDIO_BLOCK_FRAMES) <=
+         AUDIO_TARGET_FRAMES) {
+    ApuRender(pApp->pApu, block, AUDIO_BLOCK_FRAMES);
+    pApp->audioRing.Push(block, AUDIO_BLOCK_FRAMES * 2);
+  }
+}
+
+void PlaySounds(SDLAPP *pApp) {
+  uint32_t sounds = GameTakeSounds(pApp->pGameState);
+  if (pApp->pApu == nullptr) return;
+
+  for (int i = 0; i < SND_COUNT; ++i) {
+    if ((sounds >> i) & 1) ApuPlaySound(pApp->pApu, i);
+  }
+}
+
+bool StartAudio(SDLAPP *pApp) {
+  SDL_AudioSpec want, have;
+  SDL_zero(want);
+  want.freq = AUDIO_RATE;
+  want.format = AUDIO_S16SYS;
+  want.channels = 2;
+  want.samples = AUDIO_DEVICE_FRAMES;
+  want.callback = AudioCallback;
+  want.userdata = pApp;
+
+  // No allowed changes, SDL converts if the hardware differs
+  pApp->audioDevice = SDL_OpenAudioDevice(nullptr, 0, &want, &have, 0);
+  if (pApp->audioDevice == 0) {
+    Error("SDL_OpenAudioDevice");
+    return false;
+  }
+
+  pApp->pApu = ApuCreate(AUDIO_RATE);
+  PumpAudio(pApp);
+  SDL_PauseAudioDevice(pApp->audioDevice, 0);
+
+  std::cout << "LOG:Audio latency "
+            << (AUDIO_TARGET_FRAMES + have.samples) * 1000 / AUDIO_RATE
+            << "ms" << std::endl;
+  return true;
+}
+
+void StopAudio(SDLAPP *pApp) {
+  if (pApp->audioDevice == 0) return;
+
+  SDL_CloseAudioDevice(pApp->audioDevice);
+  pApp->audioDevice = 0;
+  ApuDestroy(pApp->pApu);
+  pApp->pApu = nullptr;
+
+  std::cout << "LOG:Audio underruns " << pApp->audioUnderruns << std::endl;
+}
+
+// In the background: sound off, the presenter rests, the loop blocks
+void SetPaused(SDLAPP *pApp, bool isPaused) {
+  if (pApp->isPaused == isPaused) return;
+
+  pApp->isPaused = isPaused;
+  pApp->isIdle = isPaused;
+  if (pApp->audioDevice)
+    SDL_PauseAudioDevice(pApp->audioDevice, isPaused ? 1 : 0);
+  Log(isPaused ? "Paused" : "Resumed");
+}
+
+struct CaptureRows {
+  const uint16_t *pixs;
+  uint8_t *decomGif;
+};
+
+static void DecompressRows(void *pData, int begin, int end) {
+  CaptureRows *pRows = (CaptureRows *)pData;
+  for (int c = begin * GB_WIDTH; c < (end * GB_WIDTH); ++c) {
+    uint16_t pix = pRows->pixs[c];
+    pRows->decomGif[c * 4 + 0] = ((pix & 0xF00) >> 8) * 17;
+    pRows->decomGif[c * 4 + 1] = ((pix & 0x0F0) >> 4) * 17;
+    pRows->decomGif[c * 4 + 2] = (pix & 0x00F) * 17;
+  }
+}
+
+// Feeds the GIF, on whichever thread rendered the frame
+void CaptureFrame(SDLAPP *pApp, const uint16_t *pixs) {
+  bool wantRecording = pApp->wantRecording;
+  if (wantRecording != pApp->isRecording) {
+    pApp->isRecording = wantRecording;
+    if (wantRecording) {
+      pApp->writer.firstFrame = true;
+      GifBegin(&pApp->writer, "cat.gif", GB_WIDTH, GB_HEIGHT, s_FrameRate);
+    } else {
+      GifEnd(&pApp->writer);
+    }
+  }
+
+  if (pApp->isTiled && (pApp->isRecording || pApp->pBroadcast)) {
+    TilesToLinear(pixs, pApp->captureLinear, GB_WIDTH, GB_HEIGHT);
+    pixs = pApp->captureLinear;
+  }
+
+  if (pApp->isRecording) {
+    CaptureRows rows = {pixs, pApp->decomGif};
+    JobParallelFor(pApp->pJobs, DecompressRows, &rows, 0, GB_HEIGHT, 16);
+    GifWriteFrame(&pApp->writer, pApp->decomGif, GB_WIDTH, GB_HEIGHT,
+                  s_FrameRate / 10);
+  }
+
+  if (pApp->pBroadcast) BroadcastFrame(pApp->pBroadcast, pixs);
+}
+
+void DrawFrame(SDLAPP *pApp, GameStateData *pGameState, uint16_t *pixs) {
+  Rect srcRect = {0, 0, GB_WIDTH, GB_HEIGHT};
+  if (pApp->isTiled)
+    RenderTiled(pGameState, pixs, &srcRect);
+  else
+    Render(pGameState, pixs, &srcRect);
+}
+
+void RenderFrame(SDLAPP *pApp, GameStateData *pGameState, uint16_t *pixs) {
+  DrawFrame(pApp, pGameState, pixs);
+  CaptureFrame(pApp, pixs);
+}
+
+// Hands the frame in frames.Back() to the present thread
+void SubmitFrame(SDLAPP *pApp) {
+  if (!pApp->frames.Publish()) ++pApp->framesDropped;
+  SDL_SemPost(pApp->presentWake);
+}
+
+// Presents at display rate, vsync only ever blocks this thread
+void PresentThread(SDLAPP *pApp) {
+  SDL_Rect srcRect = {0, 0, GB_WIDTH, GB_HEIGHT};
+  SDL_Rect tarRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
+  SDL_Texture *pBackBuffTex = nullptr;
+  uint16_t *linear = pApp->isTiled ? new uint16_t[GB_WIDTH * GB_HEIGHT]
+                                   : nullptr;
+
+  pApp->m_renderer = SDL_CreateRenderer(
+      pApp->m_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+  if (pApp->m_renderer == nullptr) {
+    Error("SDL_CreateRenderer");
+  } else {
+    pBackBuffTex =
+        SDL_CreateTexture(pApp->m_renderer, SDL_PIXELFORMAT_RGB444,
+                          SDL_TEXTUREACCESS_STREAMING, GB_WIDTH, GB_HEIGHT);
+    if (pBackBuffTex == nullptr) {
+      Error("SDL_CreateTexture");
+      SDL_DestroyRenderer(pApp->m_renderer);
+      pApp->m_renderer = nullptr;
+    }
+  }
+  SDL_SemPost(pApp->presentWake);  // Started, m_renderer says how it went
+  if (pApp->m_renderer == nullptr) {
+    delete[] linear;
+    return;
+  }
+
+  SDL_RendererInfo info;
+  bool isVsync = (SDL_GetRendererInfo(pApp->m_renderer, &info) == 0) &&
+                 (info.flags & SDL_RENDERER_PRESENTVSYNC);
+
+  bool hasFrame = false;
+  while (!pApp->quitPresent) {
+    if (pApp->frames.Fetch()) {
+      const uint16_t *pixs = pApp->frames.Front();
+      if (linear) {
+        TilesToLinear(pixs, linear, GB_WIDTH, GB_HEIGHT);
+        pixs = linear;
+      }
+      SDL_UpdateTexture(pBackBuffTex, &srcRect, pixs, GB_WIDTH * 2);
+      hasFrame = true;
+      ++pApp->framesPresented;
+    } else if (isVsync && hasFrame && !pApp->isIdle) {
+      // Keep the display cadence, show the last frame again
+      ++pApp->framesDuplicated;
+    } else {
+      SDL_SemWaitTimeout(pApp->presentWake, 100);
+      continue;
+    }
+
+    SDL_RenderClear(pApp->m_renderer);
+    SDL_RenderCopy(pApp->m_renderer, pBackBuffTex, &srcRect, &tarRect);
+    SDL_RenderPresent(pApp->m_renderer);
+  }
+
+  SDL_DestroyTexture(pBackBuffTex);
+  SDL_DestroyRenderer(pApp->m_renderer);
+  delete[] linear;
+}
+
+bool StartPresenter(SDLAPP *pApp) {
+  for (int i = 0; i < 3; ++i) {
+    pApp->frames.Slot(i) = new uint16_t[GB_WIDTH * GB_HEIGHT];
+    memset(pApp->frames.Slot(i), 0, GB_WIDTH * GB_HEIGHT * 2);
+  }
+
+  pApp->presentWake = SDL_CreateSemaphore(0);
+  pApp->quitPresent = false;
+  pApp->presentThread = std::thread(PresentThread, pApp);
+  SDL_SemWait(pApp->presentWake);
+  if (pApp->m_renderer == nullptr) {
+    pApp->presentThread.join();
+    return false;
+  }
+  return true;
+}
+
+void StopPresenter(SDLAPP *pApp) {
+  if (!pApp->presentThread.joinable()) return;
+
+  pApp->quitPresent = true;
+  SDL_SemPost(pApp->presentWake);
+  pApp->presentThread.join();
+  SDL_DestroySemaphore(pApp->presentWake);
+
+  for (int i = 0; i < 3; ++i) delete[] pApp->frames.Slot(i);
+}
+
+void GetPresentStats(SDLAPP *pApp, uint64_t *pPresented, uint64_t *pDropped,
+                     uint64_t *pDuplicated) {
+  *pPresented = pApp->framesPresented;
+  *pDropped = pApp->framesDropped;
+  *pDuplicated = pApp->framesDuplicated;
+}
+
+// Draws the newest snapshot while the main thread simulates the next tick
+void RenderThread(SDLAPP *pApp) {
+  while (!pApp->quitRender) {
+    SDL_SemWaitTimeout(pApp->renderWake, 100);
+    if (!pApp->snapshots.Fetch()) continue;
+
+    RenderFrame(pApp, pApp->snapshots.Front(), pApp->frames.Back());
+    SubmitFrame(pApp);
+  }
+}
+
+void StartPipeline(SDLAPP *pApp, const GameAssets *pAssets) {
+  for (int i = 0; i < 3; ++i) {
+    pApp->snapshots.Slot(i) =
+        GameSetupWithAssets(pAssets, GB_WIDTH, GB_HEIGHT, 0);
+  }
+
+  pApp->renderWake = SDL_CreateSemaphore(0);
+  pApp->quitRender = false;
+  pApp->renderThread = std::thread(RenderThread, pApp);
+  pApp->isPipelined = true;
+}
+
+void StopPipeline(SDLAPP *pApp) {
+  if (!pApp->isPipelined) return;
+
+  pApp->quitRender = true;
+  SDL_SemPost(pApp->renderWake);
+  pApp->renderThread.join();
+  SDL_DestroySemaphore(pApp->renderWake);
+
+  // Snapshots live as long as the game state does
+  pApp->isPipelined = false;
+}
+
+/////// FRAME GRAPH
+// simulate -> render -> { capture, submit }, or in pipelined mode
+// simulate -> hand off to the render thread
+
+struct FrameGraph {
+  SDLAPP *pApp;
+  int steps;
+  uint16_t *pixs;
+  bool isUnchanged;  // Same picture as last frame, nothing after simulate
+};
+
+static void SimulateJob(void *pData) {
+  FrameGraph *pFrame = (FrameGraph *)pData;
+  SDLAPP *pApp = pFrame->pApp;
+  for (int i = 0; i < pFrame->steps; ++i) GameStep(pApp);
+
+  // A GIF wants every frame
+  uint32_t key = GameRenderKey(pApp->pGameState);
+  pFrame->isUnchanged = (key == pApp->lastRenderKey) && !pApp->wantRecording;
+  pApp->lastRenderKey = key;
+}
+
+static void HandOffJob(void *pData) {
+  if (((FrameGraph *)pData)->isUnchanged) return;
+  SDLAPP *pApp = ((FrameGraph *)pData)->pApp;
+  GameCopyRenderState(pApp->snapshots.Back(), pApp->pGameState);
+  pApp->snapshots.Publish();
+  SDL_SemPost(pApp->renderWake);
+}
+
+static void RenderJob(void *pData) {
+  FrameGraph *pFrame = (FrameGraph *)pData;
+  if (pFrame->isUnchanged) return;
+  DrawFrame(pFrame->pApp, pFrame->pApp->pGameState, pFrame->pixs);
+}
+
+static void CaptureJob(void *pData) {
+  FrameGraph *pFrame = (FrameGraph *)pData;
+  if (pFrame->isUnchanged) return;
+  CaptureFrame(pFrame->pApp, pFrame->pixs);
+}
+
+static void SubmitJob(void *pData) {
+  FrameGraph *pFrame = (FrameGraph *)pData;
+  if (pFrame->isUnchanged) return;
+  SubmitFrame(pFrame->pApp);
+}
+
+void RunFrame(SDLAPP *pApp, int steps) {
+  JobSystem *pJobs = pApp->pJobs;
+  FrameGraph frame = {pApp, steps, pApp->frames.Back(), false};
+
+  Job *pDone = JobCreate(pJobs, nullptr, nullptr);
+  Job *pSimulate = JobCreate(pJobs, SimulateJob, &frame);
+
+  if (pApp->isPipelined) {
+    Job *pHandOff = JobCreate(pJobs, HandOffJob, &frame);
+    JobAddDependency(pHandOff, pSimulate);
+    JobAddDependency(pDone, pHandOff);
+    JobSubmit(pJobs, pHandOff);
+  } else {
+    Job *pRender = JobCreate(pJobs, RenderJob, &frame);
+    Job *pCapture = JobCreate(pJobs, CaptureJob, &frame);
+    Job *pSubmit = JobCreate(pJobs, SubmitJob, &frame);
+    JobAddDependency(pRender, pSimulate);
+    JobAddDependency(pCapture, pRender);
+    JobAddDependency(pSubmit, pRender);
+    JobAddDependency(pDone, pCapture);
+    JobAddDependency(pDone, pSubmit);
+    JobSubmit(pJobs, pRender);
+    JobSubmit(pJobs, pCapture);
+    JobSubmit(pJobs, pSubmit);
+  }
+
+  JobSubmit(pJobs, pDone);
+  JobSubmit(pJobs, pSimulate);
+  JobWait(pJobs, pDone);
+
+  pApp->isIdle = frame.isUnchanged;
+  if (frame.isUnchanged) ++pApp->framesSkipped;
+}
+
+int RunReplay(const char *filename, int seekTick, const char *atlasFile) {
+  InputLog *pLog = InputLogLoad(filename);
+  if (pLog == nullptr) return -1;
+
+  GameAssets *pAssets = atlasFile
+                            ? AtlasLoad(atlasFile)
+                            : GameLoadAssets("sprites.bmp", "floor.bmp");
+  if (pAssets == nullptr) return -1;
+
+  if (seekTick >= 0) {
+    ReplayPlayer *pPlayer = ReplayPlayerCreate(pLog, pAssets);
+    Uint64 start = SDL_GetPerformanceCounter();
+    int simulated = ReplaySeek(pPlayer, seekTick);
+    double seconds = (double)(SDL_GetPerformanceCounter() - start) /
+                     (double)SDL_GetPerformanceFrequency();
+    std::cout << "REPLAY: seek to " << ReplayGetTick(pPlayer) << " simulated "
+              << simulated << " ticks in " << seconds << "s" << std::endl;
+    ReplayPlayerDestroy(pPlayer);
+  }
+
+  ReplayResult res = InputLogReplay(pLog, pAssets);
+
+  std::cout << "REPLAY:" << filename << " seed " << InputLogSeed(pLog) << " "
+            << res.ticksRun << "/" << InputLogNumTicks(pLog) << " ticks in "
+            << res.seconds << "s ("
+            << (res.seconds > 0 ? res.ticksRun / res.seconds : 0)
+            << " ticks/s)" << std::endl;
+  if (res.divergedTick >= 0)
+    std::cout << "REPLAY: diverged at tick " << res.divergedTick << std::endl;
+
+  InputLogDestroy(pLog);
+  return (res.divergedTick >= 0) ? 1 : 0;
+}
+
+// Shows someone else's game until they stop
+int RunWatch(const char *host, int port) {
+  SDLAPP *pApp = CreateApp();
+  if (pApp == nullptr) return -1;
+  if (!StartPresenter(pApp)) {
+    CleanQuit(pApp);
+    return -1;
+  }
+
+  BroadcastView *pView = BroadcastConnect(host, port);
+  if (pView == nullptr) {
+    Error("BroadcastConnect");
+    StopPresenter(pApp);
+    CleanQuit(pApp);
+    return -1;
+  }
+
+  bool isOpen = true;
+  while (isOpen && PollEvents(pApp)) {
+    bool hasFrame;
+    isOpen = BroadcastReceive(pView, pApp->frames.Back(), GB_WIDTH, GB_HEIGHT,
+                              &hasFrame);
+    if (hasFrame) {
+      SubmitFrame(pApp);
+    } else {
+      SDL_Delay(1);
+    }
+  }
+  if (!isOpen) Log("Broadcast ended");
+
+  BroadcastDisconnect(pView);
+  StopPresenter(pApp);
+  CleanQuit(pApp);
+  return 0;
+}
 
 int main(int argc, char *argv[]) {
+  // -replay file : run a recorded session headless and exit
+  // -seek tick   : with -replay, time a seek to tick first
+  // -record file : save this session's input to file, nothing by default
+  // -hash        : with -record, store per-tick state hashes too
+  // -pipelined   : render on a second thread a frame behind the simulation
+  // -seed N      : game seed, both sides of a two player game need the same
+  // -net L R     : two player rollback game from UDP port L to port R
+  // -host addr   : other side's IPv4 address (default 127.0.0.1)
+  // -player N    : cat this side plays, 0 or 1
+  // -delay N     : ticks of local input delay
+  // -latency ms  : fake network delay, -jitter ms and -loss percent too
+  // -broadcast P : let spectators watch on TCP port P
+  // -watch addr P: spectate a game broadcast from addr port P
+  // -atlas file  : load sprites and floor from a baked atlas (headless -bake)
+  // -hotreload   : pick up saves to sprites.bmp and floor.bmp while running
+  // -tiled       : draw frames in 8x8 tiles (see tiles.h)
+  const char *recordFile = nullptr;
+  const char *replayFile = nullptr;
+  int seekTick = -1;
+  bool recordHashes = false;
+  bool pipelined = false;
+  uint32_t seed = (uint32_t)SDL_GetPerformanceCounter();
+  NetConfig netConfig = {0, 0, "127.0.0.1", 0, 0, 0, 0, 0};
+  bool useNet = false;
+  int broadcastPort = 0;
+  const char *watchHost = nullptr;
+  int watchPort = 0;
+  const char *atlasFile = nullptr;
+  bool hotReload = false;
+  bool tiled = false;
+  for (int i = 1; i < argc; ++i) {
+    if ((strcmp(argv[i], "-replay") == 0) && (i + 1 < argc))
+      replayFile = argv[++i];
+    else if ((strcmp(argv[i], "-seek") == 0) && (i + 1 < argc))
+      seekTick = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-record") == 0) && (i + 1 < argc))
+      recordFile = argv[++i];
+    else if (strcmp(argv[i], "-hash") == 0)
+      recordHashes = true;
+    else if (strcmp(argv[i], "-pipelined") == 0)
+      pipelined = true;
+    else if ((strcmp(argv[i], "-seed") == 0) && (i + 1 < argc))
+      seed = (uint32_t)strtoul(argv[++i], nullptr, 10);
+    else if ((strcmp(argv[i], "-net") == 0) && (i + 2 < argc)) {
+      useNet = true;
+      netConfig.localPort = atoi(argv[++i]);
+      netConfig.remotePort = atoi(argv[++i]);
+    } else if ((strcmp(argv[i], "-host") == 0) && (i + 1 < argc))
+      netConfig.remoteHost = argv[++i];
+    else if ((strcmp(argv[i], "-player") == 0) && (i + 1 < argc))
+      netConfig.localPlayer = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-delay") == 0) && (i + 1 < argc))
+      netConfig.inputDelay = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-latency") == 0) && (i + 1 < argc))
+      netConfig.latencyMs = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-jitter") == 0) && (i + 1 < argc))
+      netConfig.jitterMs = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-loss") == 0) && (i + 1 < argc))
+      netConfig.lossPercent = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-broadcast") == 0) && (i + 1 < argc))
+      broadcastPort = atoi(argv[++i]);
+    else if ((strcmp(argv[i], "-watch") == 0) && (i + 2 < argc)) {
+      watchHost = argv[++i];
+      watchPort = atoi(argv[++i]);
+    } else if ((strcmp(argv[i], "-atlas") == 0) && (i + 1 < argc))
+      atlasFile = argv[++i];
+    else if (strcmp(argv[i], "-hotreload") == 0)
+      hotReload = true;
+    else if (strcmp(argv[i], "-tiled") == 0)
+      tiled = true;
+  }
+
+  if (replayFile) return RunReplay(replayFile, seekTick, atlasFile);
+  if (watchHost) return RunWatch(watchHost, watchPort);
+
   SDLAPP *pApp = CreateApp();
   if (pApp == nullptr) {
     return -1;
   }
+  pApp->isTiled = tiled;
 
-  SDL_Rect srcRect = {0, 0, GB_WIDTH, GB_HEIGHT};
-  SDL_Rect tarRect = {0, 0, SCREEN_WIDTH, SCREEN_HEIGHT};
-  uint16_t *pixs = new uint16_t[GB_WIDTH * GB_HEIGHT];
-  SDL_Texture *pBackBuffTex =
-      SDL_CreateTexture(pApp->m_renderer, SDL_PIXELFORMAT_RGB444,
-                        SDL_TEXTUREACCESS_STREAMING, GB_WIDTH, GB_HEIGHT);
-
-  buttons = {0, 0, 0, 0};
-  pGameState = GameSetup(GB_WIDTH, GB_HEIGHT);
+  if (!StartPresenter(pApp)) {
+    CleanQuit(pApp);
+    return -1;
+  }
 
-  if (GameStep() == 0) {
+  pApp->pJobs = JobSystemCreate(0);
+  // Both sides of a net game need the same art, so no reloading there
+  if (hotReload && !useNet) {
+    pApp->pWatcher = WatcherCreate("sprites.bmp", "floor.bmp");
+    if (pApp->pWatcher == nullptr) Log("Running without hot reload");
+  }
+  const GameAssets *pAssets;
+  if (pApp->pWatcher)
+    pAssets = WatcherAssets(pApp->pWatcher);
+  else if (atlasFile)
+    pAssets = AtlasLoad(atlasFile);
+  else
+    pAssets = GameLoadAssetsWithJobs(pApp->pJobs, "sprites.bmp", "floor.bmp");
+  if (pAssets == nullptr) {
+    Error("Loading assets");
+    StopPresenter(pApp);
     CleanQuit(pApp);
-    return 0;
+    return -1;
+  }
+  pApp->pGameState = GameSetupWithAssets(pAssets, GB_WIDTH, GB_HEIGHT, seed);
+  if (useNet) {
+    GameAddSecondCat(pApp->pGameState);
+    pApp->pNet = NetCreate(pApp->pGameState, &netConfig);
+    if (pApp->pNet == nullptr) {
+      Error("NetCreate");
+      StopPresenter(pApp);
+      CleanQuit(pApp);
+      return -1;
+    }
+  } else if (recordFile) {
+    pApp->pInputLog = InputLogCreate(seed, GB_WIDTH, GB_HEIGHT, recordHashes);
+    InputLogSetKeyframeInterval(pApp->pInputLog, REPLAY_KEYFRAME_TICKS);
+  }
+  if (broadcastPort) {
+    pApp->pBroadcast = BroadcastCreate(broadcastPort, GB_WIDTH, GB_HEIGHT);
+    if (pApp->pBroadcast == nullptr) Log("Running without broadcast");
   }
+  pApp->replayFile = recordFile;
+  pApp->pRewind = RewindCreate(REWIND_BUDGET_BYTES);
+  RewindPush(pApp->pRewind, pApp->pGameState);
 
-  uint8_t *decomGif = new uint8_t[GB_HEIGHT * GB_WIDTH * 4];
+  if (pipelined) StartPipeline(pApp, pAssets);
+  if (!StartAudio(pApp)) Log("Running without sound");
 
-  // RenderTestScene(pixs, srcRect);
+  // RenderTestScene(pApp->frames.Back(), {0, 0, GB_WIDTH, GB_HEIGHT});
 
-  do {
-    Render(pGameState, pixs, &Rect{srcRect.x, srcRect.y, srcRect.w, srcRect.h});
+  FramePacer pacer;
+  PacerReset(pacer);
 
-    if (isRecording) {
-      for (int c = 0; c < (GB_WIDTH * GB_HEIGHT); ++c) {
-        decomGif[c * 4 + 0] = ((pixs[c] & 0xF00) >> 8) * 17;
-        decomGif[c * 4 + 1] = ((pixs[c] & 0x0F0) >> 4) * 17;
-        decomGif[c * 4 + 2] = (pixs[c] & 0x00F) * 17;
-      }
-      GifWriteFrame(&writer, decomGif, GB_WIDTH, GB_HEIGHT, s_FrameRate / 10);
+  while (PollEvents(pApp)) {
+    // In the background block until something happens, then don't catch up
+    // ...unless the other player is waiting on us, or an art tool has focus
+    SetPaused(pApp, !pApp->pNet && !pApp->pWatcher &&
+                        (!pApp->isFocused || pApp->isMinimized));
+    if (pApp->isPaused) {
+      SDL_WaitEventTimeout(nullptr, IDLE_WAIT_MS);
+      PacerResume(pacer);
+      continue;
     }
 
-    SDL_UpdateTexture(pBackBuffTex, &srcRect, pixs, GB_WIDTH * 2);
+    // Run every tick that is due, render once
+    Uint64 now = SDL_GetPerformanceCounter();
+    int steps = 0;
+    while ((now >= PacerDeadline(pacer)) && (steps < MAX_CATCHUP_TICKS)) {
+      ++pacer.ticks;
+      ++steps;
+    }
+    pacer.totalTicks += steps;
+    if (steps > 1) ++pacer.lateFrames;
 
-    SDL_RenderClear(pApp->m_renderer);
-    SDL_RenderCopy(pApp->m_renderer, pBackBuffTex, &srcRect, &tarRect);
-    SDL_RenderPresent(pApp->m_renderer);
+    if (now >= PacerDeadline(pacer)) {
+      // Too far behind to catch up (debugger, window drag), drop the backlog
+      Uint64 behind =
+          (now - PacerDeadline(pacer)) * TICK_RATE / pacer.freq + 1;
+      pacer.droppedTicks += behind;
+      pacer.origin = now;
+      pacer.ticks = 1;
+      std::cout << "LOG:Dropped " << behind << " ticks" << std::endl;
+    }
 
-    // Sleep
-    if ((s_FrameRate) > (SDL_GetTicks() - start_time)) {
-      SDL_Delay((s_FrameRate) -
-                (SDL_GetTicks() - start_time));  // Yay stable framerate!
+    // New art goes in between frames, snapshots and rewind keep following
+    // the game state's pointer
+    if (pApp->pWatcher) {
+      const GameAssets *pNew = WatcherPoll(pApp->pWatcher);
+      if (pNew) GameSetAssets(pApp->pGameState, pNew);
     }
 
-  } while (GameStep());
+    if (steps > 0) RunFrame(pApp, steps);
+    PlaySounds(pApp);
+    PumpAudio(pApp);
+
+    pacer.isRelaxed = pApp->isIdle;
+    while (!PacerWait(pacer, AUDIO_PUMP_MS)) PumpAudio(pApp);
+  }
+
+  std::cout << "LOG:Ticks " << pacer.totalTicks << " late frames "
+            << pacer.lateFrames << " dropped ticks " << pacer.droppedTicks
+            << std::endl;
+
+  StopAudio(pApp);
+  StopPipeline(pApp);
+  StopPresenter(pApp);
+
+  uint64_t presented, dropped, duplicated;
+  GetPresentStats(pApp, &presented, &dropped, &duplicated);
+  std::cout << "LOG:Frames presented " << presented << " dropped " << dropped
+            << " duplicated " << duplicated << " skipped "
+            << pApp->framesSkipped << std::endl;
 
-  delete[] decomGif;
+  if (pApp->isRecording) GifEnd(&pApp->writer);
+  delete[] pApp->decomGif;
+  delete[] pApp->captureLinear;
 
   CleanQuit(pApp);
   return 0;
@@ -0,0 +1,314 @@
+#include "netplay.h"
+#include "gamestate.h"
+#include "sockets.h"
+#include <deque>
+#include <random>
+#include <stddef.h>
+#include <string.h>
+
+const int MAX_ROLLBACK = 12;   // Ticks either side may guess ahead
+const int STATE_HISTORY = 16;  // Saved states, more than MAX_ROLLBACK
+const int INPUT_HISTORY = 128;
+const int MAX_PACKET_INPUTS = 32;
+const int MAX_INPUT_DELAY = 8;
+const uint32_t NET_MAGIC = 0x504E4247;  // "GBNP"
+
+// Both sides are this build on one machine or LAN, sent as is
+struct NetPacket {
+  uint32_t magic;
+  int32_t firstTick;  // Of inputs[0]
+  int32_t ackTick;    // Newest of the receiver's inputs the sender has
+  int32_t hashTick;   // Newest tick the sender has confirmed
+  uint32_t hash;      // State after hashTick
+  uint8_t numInputs;
+  uint8_t inputs[MAX_PACKET_INPUTS];  // Held bits, see GameButtonBits
+};
+const int NET_HEADER_SIZE = (int)offsetof(NetPacket, inputs);
+
+struct DelayedPacket {
+  Uint64 sendAt;
+  NetPacket packet;
+  int size;
+};
+
+struct NetSession {
+  GameStateData* pGame;
+  NetConfig config;
+  NetSocket sock;
+  sockaddr_in remoteAddr;
+  int localPlayer, remotePlayer;
+
+  int tick;          // Next tick to simulate
+  int localLatest;   // Newest local input, tick + inputDelay
+  int remoteLatest;  // Newest remote input, they arrive in order
+  int remoteAck;     // Newest local input the other side has
+
+  // Inputs per player by tick, and the remote guess each tick ran with
+  uint8_t inputs[2][INPUT_HISTORY];
+  uint8_t guessed[STATE_HISTORY];
+
+  // State before each of the last ticks, forks so saving is a copy
+  GameStateData* states[STATE_HISTORY];
+
+  // Hashes of confirmed states, checked against the other side's
+  int confirmedTick;  // Ticks whose inputs are all known
+  uint32_t hashes[INPUT_HISTORY];
+  int hashTicks[INPUT_HISTORY];
+  int remoteHashTick;
+  uint32_t remoteHash;
+  int checkedHashTick;
+
+  // Fake network
+  std::deque<DelayedPacket> outgoing;
+  std::mt19937 netRand;
+
+  NetStats stats;
+};
+
+static uint8_t Input(const NetSession& s, int player, int tick) {
+  if (tick < 0) return 0;
+  if (player == s.remotePlayer) {
+    // Guess they're still holding whatever they were
+    if (s.remoteLatest < 0) return 0;
+    if (tick > s.remoteLatest) tick = s.remoteLatest;
+  }
+  return s.inputs[player][tick % INPUT_HISTORY];
+}
+
+static ButState TickButtons(const NetSession& s, int player, int tick) {
+  return GameHeldButtons(Input(s, player, tick), Input(s, player, tick - 1));
+}
+
+static void SimulateTick(NetSession& s, int tick) {
+  GameForkInto(s.states[tick % STATE_HISTORY], s.pGame);
+  s.guessed[tick % STATE_HISTORY] = Input(s, s.remotePlayer, tick);
+
+  ButState buttons[2];
+  buttons[0] = TickButtons(s, 0, tick);
+  buttons[1] = TickButtons(s, 1, tick);
+  TickVersus(s.pGame, &buttons[0], &buttons[1]);
+}
+
+// Back to the state before fromTick and forward again with what's known now.
+// Effects and sounds of those ticks already happened, so they aren't redone.
+static void Rollback(NetSession& s, int fromTick) {
+  Uint64 start = SDL_GetPerformanceCounter();
+  ParticleSystem* pParticles = s.pGame->pParticles;
+  uint32_t sounds = s.pGame->sounds;
+  s.pGame->pParticles = nullptr;
+
+  GameForkInto(s.pGame, s.states[fromTick % STATE_HISTORY]);
+  for (int t = fromTick; t < s.tick; ++t) SimulateTick(s, t);
+
+  s.pGame->pParticles = pParticles;
+  s.pGame->sounds = sounds;
+
+  int length = s.tick - fromTick;
+  double ms = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 /
+              (double)SDL_GetPerformanceFrequency();
+  s.stats.rollbacks++;
+  s.stats.resimulated += length;
+  if (length > s.stats.maxRollback) s.stats.maxRollback = length;
+  if (ms > s.stats.maxRollbackMs) s.stats.maxRollbackMs = ms;
+}
+
+static void CheckDesync(NetSession& s) {
+  int t = s.remoteHashTick;
+  if ((t <= s.checkedHashTick) || (s.hashTicks[t % INPUT_HISTORY] != t))
+    return;
+  if (s.hashes[t % INPUT_HISTORY] != s.remoteHash) {
+    SDL_Log("Net desync at tick %d", t);
+    s.stats.desyncs++;
+  }
+  s.checkedHashTick = t;
+}
+
+// Hash each state as the last input it depends on arrives
+static void UpdateConfirmed(NetSession& s) {
+  int confirmed = s.remoteLatest + 1;
+  if (confirmed > s.tick) confirmed = s.tick;
+  for (int t = s.confirmedTick; t < confirmed; ++t) {
+    GameStateData* pAfter = (t + 1 < s.tick)
+                                ? s.states[(t + 1) % STATE_HISTORY]
+                                : s.pGame;
+    s.hashes[t % INPUT_HISTORY] = GameStateHash(pAfter);
+    s.hashTicks[t % INPUT_HISTORY] = t;
+  }
+  if (confirmed > s.confirmedTick) s.confirmedTick = confirmed;
+  CheckDesync(s);
+}
+
+static void Receive(NetSession& s) {
+  int rollbackFrom = s.tick;
+  NetPacket packet;
+  for (;;) {
+    int size = (int)recv(s.sock, (char*)&packet, sizeof(packet), 0);
+    if (size < NET_HEADER_SIZE) break;
+    if ((packet.magic != NET_MAGIC) ||
+        (size < NET_HEADER_SIZE + packet.numInputs))
+      continue;
+    s.stats.packetsReceived++;
+
+    for (int i = 0; i < packet.numInputs; ++i) {
+      int t = packet.firstTick + i;
+      if (t != s.remoteLatest + 1) continue;
+
+      // Guessed wrong for a tick already run, resimulate from there
+      uint8_t bits = packet.inputs[i];
+      s.inputs[s.remotePlayer][t % INPUT_HISTORY] = bits;
+      s.remoteLatest = t;
+      if ((t < s.tick) && (t < rollbackFrom) &&
+          (bits != s.guessed[t % STATE_HISTORY]))
+        rollbackFrom = t;
+    }
+
+    if (packet.ackTick > s.remoteAck) s.remoteAck = packet.ackTick;
+    if (packet.hashTick > s.remoteHashTick) {
+      s.remoteHashTick = packet.hashTick;
+      s.remoteHash = packet.hash;
+    }
+  }
+
+  if (rollbackFrom < s.tick) Rollback(s, rollbackFrom);
+}
+
+static void Send(NetSession& s) {
+  DelayedPacket delayed;
+  NetPacket& packet = delayed.packet;
+  packet.magic = NET_MAGIC;
+  packet.firstTick = s.remoteAck + 1;
+  if (packet.firstTick <= s.localLatest - INPUT_HISTORY)
+    packet.firstTick = s.localLatest - INPUT_HISTORY + 1;
+  int count = s.localLatest - packet.firstTick + 1;
+  if (count > MAX_PACKET_INPUTS) count = MAX_PACKET_INPUTS;
+  if (count < 0) count = 0;
+  packet.numInputs = (uint8_t)count;
+  for (int i = 0; i < count; ++i) {
+    packet.inputs[i] =
+        s.inputs[s.localPlayer][(packet.firstTick + i) % INPUT_HISTORY];
+  }
+  packet.ackTick = s.remoteLatest;
+  packet.hashTick = s.confirmedTick - 1;
+  packet.hash = (s.confirmedTick > 0)
+                    ? s.hashes[(s.confirmedTick - 1) % INPUT_HISTORY]
+                    : 0;
+  delayed.size = NET_HEADER_SIZE + count;
+
+  // Queue it as late as the fake network says, or lose it
+  Uint64 now = SDL_GetPerformanceCounter();
+  Uint64 freq = SDL_GetPerformanceFrequency();
+  int delayMs = s.config.latencyMs;
+  if (s.config.jitterMs > 0) delayMs += s.netRand() % (s.config.jitterMs + 1);
+  delayed.sendAt = now + freq * delayMs / 1000;
+  if ((int)(s.netRand() % 100) >= s.config.lossPercent)
+    s.outgoing.push_back(delayed);
+
+  // Send whatever is due, jitter can reorder them like a real network
+  for (size_t i = 0; i < s.outgoing.size();) {
+    if (s.outgoing[i].sendAt <= now) {
+      sendto(s.sock, (const char*)&s.outgoing[i].packet, s.outgoing[i].size,
+             0, (const sockaddr*)&s.remoteAddr, sizeof(s.remoteAddr));
+      s.stats.packetsSent++;
+      s.outgoing.erase(s.outgoing.begin() + i);
+    } else {
+      ++i;
+    }
+  }
+}
+
+NetSession* NetCreate(GameStateData* pGameState, const NetConfig* pConfig) {
+  sockaddr_in localAddr, remoteAddr;
+  SockAddress(localAddr, nullptr, pConfig->localPort);
+  if (!SockAddress(remoteAddr, pConfig->remoteHost, pConfig->remotePort)) {
+    SDL_Log("Net: bad address %s", pConfig->remoteHost);
+    return nullptr;
+  }
+
+  if (!SockStartup()) return nullptr;
+  NetSocket sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (sock == INVALID_SOCKET) {
+    SDL_Log("Net: couldn't create a socket");
+    SockShutdown();
+    return nullptr;
+  }
+  if (bind(sock, (const sockaddr*)&localAddr, sizeof(localAddr)) != 0) {
+    SDL_Log("Net: couldn't bind port %d", pConfig->localPort);
+    SockClose(sock);
+    SockShutdown();
+    return nullptr;
+  }
+  SockSetNonBlocking(sock);
+
+  NetSession* pSession = new NetSession();
+  NetSession& s = *pSession;
+  s.pGame = pGameState;
+  s.config = *pConfig;
+  if (s.config.inputDelay < 0) s.config.inputDelay = 0;
+  if (s.config.inputDelay > MAX_INPUT_DELAY)
+    s.config.inputDelay = MAX_INPUT_DELAY;
+  s.sock = sock;
+  s.remoteAddr = remoteAddr;
+  s.localPlayer = pConfig->localPlayer & 1;
+  s.remotePlayer = 1 - s.localPlayer;
+
+  // Nothing is held before the first tick or during the input delay
+  s.tick = 0;
+  s.localLatest = s.config.inputDelay - 1;
+  s.remoteLatest = -1;
+  s.remoteAck = -1;
+  memset(s.inputs, 0, sizeof(s.inputs));
+  memset(s.guessed, 0, sizeof(s.guessed));
+  for (int i = 0; i < STATE_HISTORY; ++i) s.states[i] = GameFork(pGameState);
+
+  s.confirmedTick = 0;
+  for (int i = 0; i < INPUT_HISTORY; ++i) s.hashTicks[i] = -1;
+  s.remoteHashTick = -1;
+  s.remoteHash = 0;
+  s.checkedHashTick = -1;
+  s.netRand.seed(pConfig->localPort);
+  memset(&s.stats, 0, sizeof(s.stats));
+  return pSession;
+}
+
+void NetDestroy(NetSession* pSession) {
+  if (pSession == nullptr) return;
+  SockClose(pSession->sock);
+  SockShutdown();
+  for (int i = 0; i < STATE_HISTORY; ++i) GameDestroy(pSession->states[i]);
+  delete pSession;
+}
+
+bool NetAdvance(NetSession* pSession, const ButState* held) {
+  NetSession& s = *pSession;
+  Receive(s);
+  UpdateConfirmed(s);
+
+  if (s.tick - s.remoteLatest > MAX_ROLLBACK) {
+    s.stats.stalls++;
+    Send(s);
+    return false;
+  }
+
+  s.localLatest = s.tick + s.config.inputDelay;
+  s.inputs[s.localPlayer][s.localLatest % INPUT_HISTORY] =
+      (uint8_t)GameButtonBits(*held);
+  SimulateTick(s, s.tick);
+  ++s.tick;
+  s.stats.ticks++;
+
+  UpdateConfirmed(s);
+  Send(s);
+  return true;
+}
+
+void NetPoll(NetSession* pSession) {
+  Receive(*pSession);
+  UpdateConfirmed(*pSession);
+  Send(*pSession);
+}
+
+void NetGetStats(NetSession* pSession, NetStats* pStats) {
+  *pStats = pSession->stats;
+  pStats->confirmedTick = pSession->confirmedTick;
+  pStats->ackedTick = pSession->remoteAck + 1;
+}
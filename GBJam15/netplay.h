@@ -0,0 +1,53 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Two player games over UDP with rollback. Each side ticks straight away
+// with its own input and a guess at the other's (whatever they last held),
+// sends its inputs every tick and, when the real ones arrive and differ
+// from the guess, restores the state from before that tick and simulates
+// forward again with them, all within one call. Both games must be set up
+// with the same seed and GameAddSecondCat.
+struct NetSession;
+
+struct NetConfig {
+  int localPlayer;         // Cat this side controls, 0 or 1
+  int localPort;
+  const char* remoteHost;  // IPv4, e.g. "127.0.0.1"
+  int remotePort;
+  int inputDelay;          // Ticks local input waits, fewer rollbacks
+
+  // Fake network conditions for testing, applied to what this side sends
+  int latencyMs;
+  int jitterMs;
+  int lossPercent;
+};
+
+struct NetStats {
+  uint64_t ticks;
+  uint64_t stalls;       // Advances refused, too far ahead of the other side
+  uint64_t rollbacks;
+  uint64_t resimulated;  // Ticks run again by rollbacks
+  int maxRollback;       // Longest rollback in ticks
+  double maxRollbackMs;  // Slowest restore + resimulate
+  uint64_t packetsSent;
+  uint64_t packetsReceived;
+  uint64_t desyncs;      // Confirmed states that hashed differently
+  int confirmedTick;     // Ticks both sides' inputs are known for
+  int ackedTick;         // Ticks of this side's input the other side has
+};
+
+NetSession* NetCreate(GameStateData* pGameState, const NetConfig* pConfig);
+void NetDestroy(NetSession* pSession);
+
+// Takes this side's held buttons (non-zero held) and ticks the game once,
+// after any rollback. Returns false without ticking when it has guessed
+// too many ticks ahead, call again next frame.
+bool NetAdvance(NetSession* pSession, const ButState* held);
+
+// Trade inputs without ticking, e.g. to let the other side finish
+void NetPoll(NetSession* pSession);
+
+void NetGetStats(NetSession* pSession, NetStats* pStats);
+};
@@ -0,0 +1,127 @@
+#include "particles.h"
+#include "gamestate.h"
+#include <string.h>
+
+#if defined(__SSE__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))
+#include <xmmintrin.h>
+#define PARTICLES_SSE 1
+#endif
+
+const float PARTICLE_GRAVITY = 0.15f;
+const float PARTICLE_DRAG = 0.94f;
+
+// xorshift32 mapped to [-1, 1)
+static float RandSigned(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return (float)(state >> 8) * (2.0f / 16777216.0f) - 1.0f;
+}
+
+ParticleSystem* ParticlesCreate(uint32_t seed) {
+  ParticleSystem* pParticles = new ParticleSystem;
+  pParticles->count = 0;
+  pParticles->rand = seed ? seed : 0x9E3779B9;
+  return pParticles;
+}
+
+void ParticlesDestroy(ParticleSystem* pParticles) { delete pParticles; }
+
+void ParticlesClear(ParticleSystem* pParticles) {
+  if (pParticles) pParticles->count = 0;
+}
+
+void ParticlesEmit(ParticleSystem* pParticles, const ParticleBurst& burst,
+                   int count) {
+  if (pParticles == nullptr) return;
+
+  ParticleSystem& p = *pParticles;
+  int end = p.count + count;
+  if (end > MAX_PARTICLES) end = MAX_PARTICLES;
+
+  float lifeJitter = burst.life * 0.25f;
+  for (int i = p.count; i < end; ++i) {
+    p.x[i] = burst.x;
+    p.y[i] = burst.y;
+    p.vx[i] = burst.vx + burst.spreadX * RandSigned(p.rand);
+    p.vy[i] = burst.vy + burst.spreadY * RandSigned(p.rand);
+    p.life[i] = burst.life + lifeJitter * RandSigned(p.rand);
+    p.colour[i] = burst.colour;
+  }
+  p.count = end;
+}
+
+void ParticlesUpdate(ParticleSystem* pParticles) {
+  if (pParticles == nullptr) return;
+
+  ParticleSystem& p = *pParticles;
+  int n = p.count;
+  int i = 0;
+
+#ifdef PARTICLES_SSE
+  const __m128 gravity = _mm_set1_ps(PARTICLE_GRAVITY);
+  const __m128 drag = _mm_set1_ps(PARTICLE_DRAG);
+  const __m128 one = _mm_set1_ps(1.0f);
+  for (; i + 4 <= n; i += 4) {
+    __m128 vx = _mm_mul_ps(_mm_loadu_ps(p.vx + i), drag);
+    __m128 vy = _mm_sub_ps(_mm_loadu_ps(p.vy + i), gravity);
+    _mm_storeu_ps(p.x + i, _mm_add_ps(_mm_loadu_ps(p.x + i), vx));
+    _mm_storeu_ps(p.y + i, _mm_add_ps(_mm_loadu_ps(p.y + i), vy));
+    _mm_storeu_ps(p.vx + i, vx);
+    _mm_storeu_ps(p.vy + i, vy);
+    _mm_storeu_ps(p.life + i, _mm_sub_ps(_mm_loadu_ps(p.life + i), one));
+  }
+#endif
+
+  for (; i < n; ++i) {
+    p.vx[i] *= PARTICLE_DRAG;
+    p.vy[i] -= PARTICLE_GRAVITY;
+    p.x[i] += p.vx[i];
+    p.y[i] += p.vy[i];
+    p.life[i] -= 1.0f;
+  }
+
+  // Swap the dead out, order doesn't matter
+  i = 0;
+  while (i < n) {
+    if (p.life[i] > 0.0f) {
+      ++i;
+      continue;
+    }
+    --n;
+    p.x[i] = p.x[n];
+    p.y[i] = p.y[n];
+    p.vx[i] = p.vx[n];
+    p.vy[i] = p.vy[n];
+    p.life[i] = p.life[n];
+    p.colour[i] = p.colour[n];
+  }
+  p.count = n;
+}
+
+void ParticlesCopy(ParticleSystem* pDst, const ParticleSystem* pSrc) {
+  if ((pDst == nullptr) || (pSrc == nullptr)) return;
+
+  int n = pSrc->count;
+  pDst->count = n;
+  memcpy(pDst->x, pSrc->x, n * sizeof(float));
+  memcpy(pDst->y, pSrc->y, n * sizeof(float));
+  memcpy(pDst->colour, pSrc->colour, n * sizeof(uint16_t));
+}
+
+void ParticlesRender(const ParticleSystem* pParticles, PixData& screen) {
+  if (pParticles == nullptr) return;
+
+  const ParticleSystem& p = *pParticles;
+  unsigned w = screen.size.w;
+  unsigned h = screen.size.h;
+  int left = screen.size.x;
+  int bottom = screen.size.h - screen.size.y;
+  for (int i = 0; i < p.count; ++i) {
+    unsigned sx = (unsigned)((int)p.x[i] - left);
+    unsigned sy = (unsigned)(bottom - (int)p.y[i]);
+    if ((sx < w) && (sy < h))
+      screen.pixs[screen.LocalI((int)sx, (int)sy)] = p.colour[i];
+  }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include <stdint.h>
+
+struct PixData;
+
+// Cosmetic particles. One fixed pool per game laid out as parallel arrays so
+// the per tick update runs four particles at a time, dead ones are swapped
+// out from the end and nothing allocates after ParticlesCreate. Emission has
+// its own RNG and the pool is never hashed or saved, so effects can't change
+// the simulation.
+const int MAX_PARTICLES = 32768;
+
+struct ParticleSystem {
+  int count;  // Live particles are [0, count)
+  uint32_t rand;
+  float x[MAX_PARTICLES];  // World space, y up
+  float y[MAX_PARTICLES];
+  float vx[MAX_PARTICLES];
+  float vy[MAX_PARTICLES];
+  float life[MAX_PARTICLES];  // Ticks left
+  uint16_t colour[MAX_PARTICLES];
+};
+
+// count particles around (x, y), velocity and life jittered per particle
+struct ParticleBurst {
+  float x, y;
+  float vx, vy;
+  float spreadX, spreadY;  // Velocity +/- this much
+  int life;                // Ticks, +/- a quarter
+  uint16_t colour;
+};
+
+ParticleSystem* ParticlesCreate(uint32_t seed);
+void ParticlesDestroy(ParticleSystem* pParticles);
+void ParticlesClear(ParticleSystem* pParticles);
+
+// Safe on nullptr, a full pool drops the rest of the burst
+void ParticlesEmit(ParticleSystem* pParticles, const ParticleBurst& burst,
+                   int count);
+
+// Move, fall and age by one tick
+void ParticlesUpdate(ParticleSystem* pParticles);
+
+// Positions and colours of the live particles, all Render needs
+void ParticlesCopy(ParticleSystem* pDst, const ParticleSystem* pSrc);
+
+// One pass plotting every live particle on screen
+void ParticlesRender(const ParticleSystem* pParticles, PixData& screen);
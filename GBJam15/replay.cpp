@@ -0,0 +1,512 @@
+#include "replay.h"
+#include "gamestate.h"
+#include "snapshot.h"
+#include <stdio.h>
+#include <vector>
+
+const uint32_t REPLAY_MAGIC = 0x50524247;  // "GBRP"
+const uint16_t REPLAY_VERSION = 2;
+const uint16_t REPLAY_FLAG_HASHES = 1;
+const uint16_t REPLAY_FLAG_KEYFRAMES = 2;
+
+// Every Nth keyframe is stored whole so seeks decode a bounded delta chain
+const int REPLAY_FULL_KEYFRAME_EVERY = 16;
+
+struct KeyframeIndex {
+  int tick;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  bool isFull;
+
+  // Input stream position to resume from
+  uint32_t inputPos;
+  int lastChangeTick;
+  uint8_t mask;
+};
+
+struct InputLog {
+  uint32_t seed;
+  uint16_t width, height;
+  uint16_t flags;
+  int numTicks;
+
+  // Pairs of varint(ticks since last change) + mask byte
+  std::vector<uint8_t> inputs;
+  std::vector<uint32_t> hashes;
+
+  // State keyframes, each a StateBlob or a delta against the one before
+  int keyframeInterval;
+  std::vector<uint8_t> keyData;
+  std::vector<KeyframeIndex> keys;
+
+  // Recording
+  uint8_t lastMask;
+  int lastChangeTick;
+  bool forceFullKey;
+  StateBlob lastKeyState;
+  StateBlob keyScratch;
+  StateBlob keyDelta;
+};
+
+struct InputCursor {
+  size_t pos;
+  uint8_t mask;
+  int nextChange;
+};
+
+struct ReplayPlayer {
+  const InputLog* pLog;
+  const GameAssets* pAssets;
+  GameStateData* pGameState;
+  InputCursor cursor;
+  int tick;
+  int divergedTick;
+
+  StateBlob keyState;
+  StateBlob keyScratch;
+};
+
+/////// BUTTON MASK
+// Low nibble is held, high nibble is pressed this tick (ButState value 3)
+
+static uint8_t ButtonsToMask(const ButState& b) {
+  const int v[4] = {b.up, b.down, b.left, b.right};
+  uint8_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    if (v[i] & 1) mask |= 1 << i;
+    if (v[i] & 2) mask |= 1 << (i + 4);
+  }
+  return mask;
+}
+
+static ButState MaskToButtons(uint8_t mask) {
+  int v[4];
+  for (int i = 0; i < 4; ++i) {
+    v[i] = ((mask >> i) & 1) | (((mask >> (i + 4)) & 1) << 1);
+  }
+  return ButState{v[0], v[1], v[2], v[3]};
+}
+
+/////// STREAM
+
+static void PutVarint(std::vector<uint8_t>& out, uint32_t v) {
+  while (v >= 0x80) {
+    out.push_back((uint8_t)(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back((uint8_t)v);
+}
+
+static bool GetVarint(const std::vector<uint8_t>& in, size_t& pos,
+                      uint32_t& v) {
+  v = 0;
+  for (int shift = 0; (pos < in.size()) && (shift < 32); shift += 7) {
+    uint8_t b = in[pos++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if ((b & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+static void PutU32(FILE* f, uint32_t v) {
+  uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16),
+                  (uint8_t)(v >> 24)};
+  fwrite(b, 1, 4, f);
+}
+
+static void PutU16(FILE* f, uint16_t v) {
+  uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+  fwrite(b, 1, 2, f);
+}
+
+static bool GetU32(FILE* f, uint32_t& v) {
+  uint8_t b[4];
+  if (fread(b, 1, 4, f) != 4) return false;
+  v = b[0] | (b[1] << 8) | (b[2] << 16) | ((uint32_t)b[3] << 24);
+  return true;
+}
+
+static bool GetU16(FILE* f, uint16_t& v) {
+  uint8_t b[2];
+  if (fread(b, 1, 2, f) != 2) return false;
+  v = (uint16_t)(b[0] | (b[1] << 8));
+  return true;
+}
+
+static bool GetBytes(FILE* f, std::vector<uint8_t>& out, uint32_t n) {
+  out.resize(n);
+  return (n == 0) || (fread(&out[0], 1, n, f) == n);
+}
+
+/////// INPUT CURSOR
+
+static void CursorReadNext(const InputLog* pLog, InputCursor& cursor,
+                           int lastChangeTick) {
+  uint32_t skip = 0;
+  if ((cursor.pos < pLog->inputs.size()) &&
+      GetVarint(pLog->inputs, cursor.pos, skip) &&
+      (cursor.pos < pLog->inputs.size())) {
+    cursor.nextChange = lastChangeTick + (int)skip;
+  } else {
+    cursor.nextChange = pLog->numTicks;
+  }
+}
+
+static void CursorInit(const InputLog* pLog, InputCursor& cursor) {
+  cursor.pos = 0;
+  cursor.mask = 0;
+  CursorReadNext(pLog, cursor, 0);
+}
+
+static ButState CursorButtons(const InputLog* pLog, InputCursor& cursor,
+                              int tick) {
+  if (tick == cursor.nextChange) {
+    cursor.mask = pLog->inputs[cursor.pos++];
+    CursorReadNext(pLog, cursor, tick);
+  }
+  return MaskToButtons(cursor.mask);
+}
+
+/////// LOG
+
+InputLog* InputLogCreate(uint32_t seed, uint16_t width, uint16_t height,
+                         bool withHashes) {
+  InputLog* pLog = new InputLog();
+  pLog->seed = seed;
+  pLog->width = width;
+  pLog->height = height;
+  pLog->flags = withHashes ? REPLAY_FLAG_HASHES : 0;
+  pLog->numTicks = 0;
+  pLog->keyframeInterval = 0;
+  pLog->lastMask = 0;
+  pLog->lastChangeTick = 0;
+  pLog->forceFullKey = false;
+  return pLog;
+}
+
+void InputLogDestroy(InputLog* pLog) { delete pLog; }
+
+void InputLogSetKeyframeInterval(InputLog* pLog, int ticks) {
+  pLog->keyframeInterval = (ticks > 0) ? ticks : 0;
+  if (pLog->keyframeInterval > 0)
+    pLog->flags |= REPLAY_FLAG_KEYFRAMES;
+  else
+    pLog->flags &= ~REPLAY_FLAG_KEYFRAMES;
+}
+
+static void InputLogAddKeyframe(InputLog* pLog, GameStateData* pGameState) {
+  KeyframeIndex key;
+  key.tick = pLog->numTicks;
+  key.isFull = pLog->forceFullKey ||
+               ((pLog->keys.size() % REPLAY_FULL_KEYFRAME_EVERY) == 0);
+  pLog->forceFullKey = false;
+  key.inputPos = (uint32_t)pLog->inputs.size();
+  key.lastChangeTick = pLog->lastChangeTick;
+  key.mask = pLog->lastMask;
+
+  StateSave(*pGameState, pLog->keyScratch);
+
+  const StateBlob* pData = &pLog->keyScratch;
+  if (!key.isFull) {
+    DeltaEncode(pLog->lastKeyState, pLog->keyScratch, pLog->keyDelta);
+    pData = &pLog->keyDelta;
+  }
+
+  key.dataOffset = (uint32_t)pLog->keyData.size();
+  key.dataSize = (uint32_t)pData->size();
+  pLog->keyData.insert(pLog->keyData.end(), pData->begin(), pData->end());
+  pLog->keys.push_back(key);
+
+  pLog->lastKeyState.swap(pLog->keyScratch);
+}
+
+void InputLogRecord(InputLog* pLog, const ButState* tickButtons,
+                    GameStateData* pGameState) {
+  uint8_t mask = ButtonsToMask(*tickButtons);
+  if (mask != pLog->lastMask) {
+    PutVarint(pLog->inputs, pLog->numTicks - pLog->lastChangeTick);
+    pLog->inputs.push_back(mask);
+    pLog->lastMask = mask;
+    pLog->lastChangeTick = pLog->numTicks;
+  }
+
+  if (pLog->flags & REPLAY_FLAG_HASHES) {
+    pLog->hashes.push_back(GameStateHash(pGameState));
+  }
+
+  ++pLog->numTicks;
+
+  if ((pLog->keyframeInterval > 0) &&
+      ((pLog->numTicks % pLog->keyframeInterval) == 0)) {
+    InputLogAddKeyframe(pLog, pGameState);
+  }
+}
+
+void InputLogTruncate(InputLog* pLog, int numTicks) {
+  if ((numTicks < 0) || (numTicks >= pLog->numTicks)) return;
+
+  // Find the input changes that happened before the cut
+  size_t pos = 0, keep = 0;
+  uint8_t mask = 0;
+  int tick = 0, lastChange = 0;
+  uint32_t skip = 0;
+  while ((pos < pLog->inputs.size()) && GetVarint(pLog->inputs, pos, skip) &&
+         (pos < pLog->inputs.size())) {
+    tick += (int)skip;
+    if (tick >= numTicks) break;
+    mask = pLog->inputs[pos++];
+    lastChange = tick;
+    keep = pos;
+  }
+  pLog->inputs.resize(keep);
+  pLog->lastMask = mask;
+  pLog->lastChangeTick = lastChange;
+
+  if (!pLog->hashes.empty()) pLog->hashes.resize(numTicks);
+
+  while (!pLog->keys.empty() && (pLog->keys.back().tick > numTicks)) {
+    pLog->keyData.resize(pLog->keys.back().dataOffset);
+    pLog->keys.pop_back();
+    pLog->forceFullKey = true;
+  }
+
+  pLog->numTicks = numTicks;
+}
+
+bool InputLogSave(const InputLog* pLog, const char* filename) {
+  FILE* f = fopen(filename, "wb");
+  if (f == nullptr) {
+    SDL_Log("Failed to write replay %s", filename);
+    return false;
+  }
+
+  PutU32(f, REPLAY_MAGIC);
+  PutU16(f, REPLAY_VERSION);
+  PutU16(f, pLog->flags);
+  PutU32(f, pLog->seed);
+  PutU16(f, pLog->width);
+  PutU16(f, pLog->height);
+  PutU32(f, pLog->numTicks);
+  PutU32(f, (uint32_t)pLog->inputs.size());
+  if (!pLog->inputs.empty())
+    fwrite(&pLog->inputs[0], 1, pLog->inputs.size(), f);
+  for (size_t i = 0; i < pLog->hashes.size(); ++i) PutU32(f, pLog->hashes[i]);
+
+  if (pLog->flags & REPLAY_FLAG_KEYFRAMES) {
+    PutU32(f, pLog->keyframeInterval);
+    PutU32(f, (uint32_t)pLog->keyData.size());
+    if (!pLog->keyData.empty())
+      fwrite(&pLog->keyData[0], 1, pLog->keyData.size(), f);
+
+    // Index
+    PutU32(f, (uint32_t)pLog->keys.size());
+    for (size_t i = 0; i < pLog->keys.size(); ++i) {
+      const KeyframeIndex& key = pLog->keys[i];
+      PutU32(f, key.tick);
+      PutU32(f, key.dataOffset);
+      PutU32(f, key.dataSize);
+      PutU32(f, key.inputPos);
+      PutU32(f, key.lastChangeTick);
+      PutU16(f, key.mask);
+      PutU16(f, key.isFull ? 1 : 0);
+    }
+  }
+
+  fclose(f);
+  return true;
+}
+
+InputLog* InputLogLoad(const char* filename) {
+  FILE* f = fopen(filename, "rb");
+  if (f == nullptr) {
+    SDL_Log("Failed to open replay %s", filename);
+    return nullptr;
+  }
+
+  InputLog* pLog = InputLogCreate(0, 0, 0, false);
+  uint32_t magic = 0, numTicks = 0, numBytes = 0;
+  uint16_t version = 0;
+  bool ok = GetU32(f, magic) && (magic == REPLAY_MAGIC) && GetU16(f, version) &&
+            (version >= 1) && (version <= REPLAY_VERSION) &&
+            GetU16(f, pLog->flags) && GetU32(f, pLog->seed) &&
+            GetU16(f, pLog->width) && GetU16(f, pLog->height) &&
+            GetU32(f, numTicks) && GetU32(f, numBytes) &&
+            GetBytes(f, pLog->inputs, numBytes);
+  pLog->numTicks = (int)numTicks;
+
+  if (ok && (pLog->flags & REPLAY_FLAG_HASHES)) {
+    pLog->hashes.resize(numTicks);
+    for (uint32_t i = 0; ok && (i < numTicks); ++i)
+      ok = GetU32(f, pLog->hashes[i]);
+  }
+
+  if (ok && (pLog->flags & REPLAY_FLAG_KEYFRAMES)) {
+    uint32_t interval = 0, numKeys = 0;
+    ok = GetU32(f, interval) && GetU32(f, numBytes) &&
+         GetBytes(f, pLog->keyData, numBytes) && GetU32(f, numKeys);
+    pLog->keyframeInterval = (int)interval;
+
+    for (uint32_t i = 0; ok && (i < numKeys); ++i) {
+      KeyframeIndex key;
+      uint32_t tick, lastChange;
+      uint16_t mask, isFull;
+      ok = GetU32(f, tick) && GetU32(f, key.dataOffset) &&
+           GetU32(f, key.dataSize) && GetU32(f, key.inputPos) &&
+           GetU32(f, lastChange) && GetU16(f, mask) && GetU16(f, isFull);
+      if (!ok) break;
+
+      // In size_t and without adding, so a crafted offset can't wrap
+      size_t keyBytes = pLog->keyData.size();
+      ok = (key.dataSize <= keyBytes) &&
+           (key.dataOffset <= keyBytes - key.dataSize) &&
+           (key.inputPos <= pLog->inputs.size());
+      if (!ok) break;
+
+      key.tick = (int)tick;
+      key.lastChangeTick = (int)lastChange;
+      key.mask = (uint8_t)mask;
+      key.isFull = isFull != 0;
+      pLog->keys.push_back(key);
+    }
+  }
+
+  fclose(f);
+
+  if (!ok) {
+    SDL_Log("Bad replay file %s", filename);
+    delete pLog;
+    return nullptr;
+  }
+
+  return pLog;
+}
+
+int InputLogNumTicks(const InputLog* pLog) { return pLog->numTicks; }
+uint32_t InputLogSeed(const InputLog* pLog) { return pLog->seed; }
+
+/////// PLAYER
+
+ReplayPlayer* ReplayPlayerCreate(const InputLog* pLog,
+                                 const GameAssets* pAssets) {
+  ReplayPlayer* pPlayer = new ReplayPlayer();
+  pPlayer->pLog = pLog;
+  pPlayer->pAssets = pAssets;
+  pPlayer->pGameState =
+      GameSetupWithAssets(pAssets, pLog->width, pLog->height, pLog->seed);
+  pPlayer->tick = 0;
+  pPlayer->divergedTick = -1;
+  CursorInit(pLog, pPlayer->cursor);
+  return pPlayer;
+}
+
+void ReplayPlayerDestroy(ReplayPlayer* pPlayer) {
+  GameDestroy(pPlayer->pGameState);
+  delete pPlayer;
+}
+
+GameStateData* ReplayGetGame(ReplayPlayer* pPlayer) {
+  return pPlayer->pGameState;
+}
+
+int ReplayGetTick(ReplayPlayer* pPlayer) { return pPlayer->tick; }
+int ReplayDivergedTick(ReplayPlayer* pPlayer) { return pPlayer->divergedTick; }
+
+bool ReplayStep(ReplayPlayer* pPlayer) {
+  const InputLog* pLog = pPlayer->pLog;
+  if (pPlayer->tick >= pLog->numTicks) return false;
+
+  ButState buttons = CursorButtons(pLog, pPlayer->cursor, pPlayer->tick);
+  Tick(pPlayer->pGameState, &buttons);
+
+  if ((pLog->flags & REPLAY_FLAG_HASHES) && (pPlayer->divergedTick < 0) &&
+      (GameStateHash(pPlayer->pGameState) != pLog->hashes[pPlayer->tick])) {
+    pPlayer->divergedTick = pPlayer->tick;
+  }
+
+  ++pPlayer->tick;
+  return true;
+}
+
+static bool ReplayLoadKeyframe(ReplayPlayer* pPlayer, int k) {
+  const InputLog* pLog = pPlayer->pLog;
+
+  int first = k;
+  while ((first > 0) && !pLog->keys[first].isFull) --first;
+  if (!pLog->keys[first].isFull) return false;
+
+  for (int i = first; i <= k; ++i) {
+    const KeyframeIndex& key = pLog->keys[i];
+    const uint8_t* data = &pLog->keyData[0] + key.dataOffset;
+    if (key.isFull) {
+      pPlayer->keyState.assign(data, data + key.dataSize);
+    } else {
+      if (!DeltaDecode(pPlayer->keyState, data, key.dataSize,
+                       pPlayer->keyScratch))
+        return false;
+      pPlayer->keyState.swap(pPlayer->keyScratch);
+    }
+  }
+
+  if (pPlayer->keyState.empty() ||
+      !StateLoad(*pPlayer->pGameState, &pPlayer->keyState[0],
+                 pPlayer->keyState.size()))
+    return false;
+
+  const KeyframeIndex& key = pLog->keys[k];
+  pPlayer->tick = key.tick;
+  pPlayer->divergedTick = -1;
+  pPlayer->cursor.pos = key.inputPos;
+  pPlayer->cursor.mask = key.mask;
+  CursorReadNext(pLog, pPlayer->cursor, key.lastChangeTick);
+  return true;
+}
+
+int ReplaySeek(ReplayPlayer* pPlayer, int tick) {
+  const InputLog* pLog = pPlayer->pLog;
+  if (tick > pLog->numTicks) tick = pLog->numTicks;
+  if (tick < 0) tick = 0;
+
+  // Latest keyframe at or before the target
+  int k = -1;
+  int lo = 0, hi = (int)pLog->keys.size() - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (pLog->keys[mid].tick <= tick) {
+      k = mid;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+
+  bool behind = tick < pPlayer->tick;
+  bool keyAhead = (k >= 0) && (pLog->keys[k].tick > pPlayer->tick);
+  if ((behind || keyAhead) && !((k >= 0) && ReplayLoadKeyframe(pPlayer, k))) {
+    // No usable keyframe, start over from the seed
+    if (behind) {
+      GameInit(*pPlayer->pGameState, pPlayer->pAssets, pLog->width,
+               pLog->height, pLog->seed);
+      pPlayer->tick = 0;
+      pPlayer->divergedTick = -1;
+      CursorInit(pLog, pPlayer->cursor);
+    }
+  }
+
+  int simulated = 0;
+  while ((pPlayer->tick < tick) && ReplayStep(pPlayer)) ++simulated;
+  return simulated;
+}
+
+ReplayResult InputLogReplay(const InputLog* pLog, const GameAssets* pAssets) {
+  ReplayResult res = {0, -1, 0.0};
+  ReplayPlayer* pPlayer = ReplayPlayerCreate(pLog, pAssets);
+
+  Uint64 start = SDL_GetPerformanceCounter();
+  while ((pPlayer->divergedTick < 0) && ReplayStep(pPlayer)) ++res.ticksRun;
+  res.seconds = (double)(SDL_GetPerformanceCounter() - start) /
+                (double)SDL_GetPerformanceFrequency();
+  res.divergedTick = pPlayer->divergedTick;
+
+  ReplayPlayerDestroy(pPlayer);
+  return res;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Per-tick input log: seed plus button bitmask deltas, optional state hashes
+struct InputLog;
+
+InputLog* InputLogCreate(uint32_t seed, uint16_t width, uint16_t height,
+                         bool withHashes);
+void InputLogDestroy(InputLog* pLog);
+
+// Call once per tick after Tick with the buttons Tick was given
+void InputLogRecord(InputLog* pLog, const ButState* tickButtons,
+                    GameStateData* pGameState);
+
+// Drop everything recorded from tick numTicks on, e.g. after a rewind
+void InputLogTruncate(InputLog* pLog, int numTicks);
+
+// Store a state keyframe every N recorded ticks so replays can seek (0 = off)
+void InputLogSetKeyframeInterval(InputLog* pLog, int ticks);
+
+bool InputLogSave(const InputLog* pLog, const char* filename);
+InputLog* InputLogLoad(const char* filename);
+
+int InputLogNumTicks(const InputLog* pLog);
+uint32_t InputLogSeed(const InputLog* pLog);
+
+struct ReplayResult {
+  int ticksRun;
+  int divergedTick;  // -1 if hashes matched or none were recorded
+  double seconds;
+};
+
+// Runs the whole log headless as fast as possible
+ReplayResult InputLogReplay(const InputLog* pLog, const GameAssets* pAssets);
+
+// Steppable playback of a log, owns its own game
+struct ReplayPlayer;
+
+ReplayPlayer* ReplayPlayerCreate(const InputLog* pLog,
+                                 const GameAssets* pAssets);
+void ReplayPlayerDestroy(ReplayPlayer* pPlayer);
+
+bool ReplayStep(ReplayPlayer* pPlayer);  // false at end of log
+// Jumps to the nearest keyframe at or before tick then simulates the rest,
+// returns the number of ticks simulated
+int ReplaySeek(ReplayPlayer* pPlayer, int tick);
+
+GameStateData* ReplayGetGame(ReplayPlayer* pPlayer);
+int ReplayGetTick(ReplayPlayer* pPlayer);
+int ReplayDivergedTick(ReplayPlayer* pPlayer);  // -1 if none
+};
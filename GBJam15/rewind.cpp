@@ -0,0 +1,113 @@
+#include "rewind.h"
+#include "snapshot.h"
+#include <deque>
+#include <string.h>
+
+struct RewindEntry {
+  uint32_t offset;
+  uint32_t size;
+};
+
+struct RewindBuffer {
+  // Deltas that turn each state back into the one before it, so the
+  // oldest can be dropped without breaking the chain
+  std::vector<uint8_t> ring;
+  std::deque<RewindEntry> entries;
+  uint32_t writePos;
+  size_t bytesUsed;
+
+  StateBlob head;  // Latest state
+  bool hasHead;
+
+  StateBlob cur;
+  StateBlob delta;
+};
+
+RewindBuffer* RewindCreate(size_t budgetBytes) {
+  RewindBuffer* pRewind = new RewindBuffer();
+  pRewind->ring.resize(budgetBytes);
+  RewindClear(pRewind);
+  return pRewind;
+}
+
+void RewindDestroy(RewindBuffer* pRewind) { delete pRewind; }
+
+void RewindClear(RewindBuffer* pRewind) {
+  pRewind->entries.clear();
+  pRewind->writePos = 0;
+  pRewind->bytesUsed = 0;
+  pRewind->hasHead = false;
+}
+
+static void RewindEvictFront(RewindBuffer* pRewind) {
+  pRewind->bytesUsed -= pRewind->entries.front().size;
+  pRewind->entries.pop_front();
+}
+
+static void RewindStore(RewindBuffer* pRewind, const StateBlob& data) {
+  uint32_t n = (uint32_t)data.size();
+  if (n > pRewind->ring.size()) {
+    // Can't hold even one step, history is gone
+    pRewind->entries.clear();
+    pRewind->writePos = 0;
+    pRewind->bytesUsed = 0;
+    return;
+  }
+
+  if (pRewind->writePos + n > pRewind->ring.size()) {
+    // Wrap, anything left in the tail is from the previous lap
+    while (!pRewind->entries.empty() &&
+           (pRewind->entries.front().offset >= pRewind->writePos))
+      RewindEvictFront(pRewind);
+    pRewind->writePos = 0;
+  }
+
+  while (!pRewind->entries.empty()) {
+    const RewindEntry& e = pRewind->entries.front();
+    if ((e.offset >= pRewind->writePos + n) ||
+        (e.offset + e.size <= pRewind->writePos))
+      break;
+    RewindEvictFront(pRewind);
+  }
+
+  if (n > 0) memcpy(&pRewind->ring[pRewind->writePos], &data[0], n);
+  pRewind->entries.push_back(RewindEntry{pRewind->writePos, n});
+  pRewind->writePos += n;
+  pRewind->bytesUsed += n;
+}
+
+void RewindPush(RewindBuffer* pRewind, GameStateData* pGameState) {
+  StateSave(*pGameState, pRewind->cur);
+
+  if (pRewind->hasHead) {
+    DeltaEncode(pRewind->cur, pRewind->head, pRewind->delta);
+    RewindStore(pRewind, pRewind->delta);
+  }
+
+  pRewind->head.swap(pRewind->cur);
+  pRewind->hasHead = true;
+}
+
+bool RewindPop(RewindBuffer* pRewind, GameStateData* pGameState) {
+  if (pRewind->entries.empty()) return false;
+
+  RewindEntry e = pRewind->entries.back();
+  const uint8_t* data = pRewind->ring.empty() ? nullptr : &pRewind->ring[0];
+  if (!DeltaDecode(pRewind->head, data + e.offset, e.size, pRewind->cur) ||
+      !StateLoad(*pGameState, &pRewind->cur[0], pRewind->cur.size())) {
+    RewindClear(pRewind);
+    return false;
+  }
+
+  pRewind->head.swap(pRewind->cur);
+  pRewind->entries.pop_back();
+  pRewind->writePos = e.offset;
+  pRewind->bytesUsed -= e.size;
+  return true;
+}
+
+int RewindNumFrames(RewindBuffer* pRewind) {
+  return (int)pRewind->entries.size();
+}
+
+size_t RewindBytesUsed(RewindBuffer* pRewind) { return pRewind->bytesUsed; }
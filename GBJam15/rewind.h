@@ -0,0 +1,19 @@
+#pragma once
+#include "cat.h"
+
+extern "C" {
+
+// Ring of per-tick reverse deltas bounded to a byte budget, oldest dropped
+struct RewindBuffer;
+
+RewindBuffer* RewindCreate(size_t budgetBytes);
+void RewindDestroy(RewindBuffer* pRewind);
+void RewindClear(RewindBuffer* pRewind);
+
+// Call after every Tick, pops step back one tick at a time
+void RewindPush(RewindBuffer* pRewind, GameStateData* pGameState);
+bool RewindPop(RewindBuffer* pRewind, GameStateData* pGameState);
+
+int RewindNumFrames(RewindBuffer* pRewind);
+size_t RewindBytesUsed(RewindBuffer* pRewind);
+};
@@ -0,0 +1,286 @@
+#include "snapshot.h"
+#include <string.h>
+
+const uint32_t STATE_BLOB_MAGIC = 0x35534247;  // "GBS5", both cats
+
+/////// WRITE / READ
+
+static void PutInt(StateBlob& out, int v) {
+  size_t i = out.size();
+  out.resize(i + 4);
+  memcpy(&out[i], &v, 4);
+}
+
+static void PutBytes(StateBlob& out, const void* src, size_t n) {
+  size_t i = out.size();
+  out.resize(i + n);
+  memcpy(&out[i], src, n);
+}
+
+struct BlobReader {
+  const uint8_t* data;
+  size_t size;
+  size_t pos;
+  bool ok;
+
+  int Int() {
+    int v = 0;
+    Bytes(&v, 4);
+    return v;
+  }
+
+  void Bytes(void* dst, size_t n) {
+    if (!ok || (pos + n > size)) {
+      ok = false;
+      return;
+    }
+    memcpy(dst, data + pos, n);
+    pos += n;
+  }
+};
+
+static void PutCat(StateBlob& out, const CatData& cat) {
+  PutInt(out, cat.state);
+  PutInt(out, cat.pos.x);
+  PutInt(out, cat.pos.y);
+  PutInt(out, cat.holdPos.x);
+  PutInt(out, cat.holdPos.y);
+  PutInt(out, cat.framesRunning);
+  PutInt(out, cat.upFrames);
+  PutInt(out, cat.noLandTimer);
+  PutInt(out, cat.isRunning);
+  PutInt(out, cat.isGrounded);
+}
+
+static void GetCat(BlobReader& in, CatData& cat) {
+  cat.state = (CatData::CState)in.Int();
+  cat.pos.x = in.Int();
+  cat.pos.y = in.Int();
+  cat.holdPos.x = in.Int();
+  cat.holdPos.y = in.Int();
+  cat.framesRunning = in.Int();
+  cat.upFrames = in.Int();
+  cat.noLandTimer = in.Int();
+  cat.isRunning = in.Int() != 0;
+  cat.isGrounded = in.Int() != 0;
+}
+
+void StateSave(const GameStateData& gameState, StateBlob& out) {
+  out.clear();
+  out.reserve(sizeof(std::mt19937) + sizeof(gameState.timers.heads) + 1024);
+
+  PutInt(out, STATE_BLOB_MAGIC);
+  PutInt(out, (int)sizeof(std::mt19937));
+
+  // Cats, the second too so its timer handle matches the wheel below
+  PutInt(out, gameState.numCats);
+  PutCat(out, gameState.cat);
+  PutCat(out, gameState.cat2);
+  PutInt(out, gameState.windowsWon[0]);
+  PutInt(out, gameState.windowsWon[1]);
+
+  // World
+  PutInt(out, gameState.scrollPoint.x);
+  PutInt(out, gameState.scrollPoint.y);
+  PutBytes(out, &gameState.level_bounds, sizeof(Rect));
+  PutInt(out, gameState.seed);
+  PutInt(out, gameState.movingLine);
+  PutInt(out, gameState.isLineMoving);
+  PutInt(out, gameState.lineTimer);
+  PutInt(out, gameState.isMeowUnlocked);
+  PutInt(out, gameState.activeWindow);
+  PutInt(out, gameState.windowOpenTick);
+  PutInt(out, gameState.windowTimer);
+  PutInt(out, gameState.animCount);
+
+  // RNG raw, only valid between builds with the same std library
+  PutBytes(out, &gameState.randGen, sizeof(std::mt19937));
+
+  // Timer wheel is all ints, handles held above stay valid. Only the nodes
+  // it has used, the rest of the pool is never read
+  const TimerWheel& timers = gameState.timers;
+  PutInt(out, timers.now);
+  PutBytes(out, timers.heads, sizeof(timers.heads));
+  PutInt(out, timers.freeHead);
+  PutInt(out, timers.numNodes);
+  PutBytes(out, timers.nodes, timers.numNodes * sizeof(TimerNode));
+
+  // Variable size last
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    const LaundryLineData& line = gameState.lines[y];
+    PutInt(out, line.offset);
+    PutInt(out, line.scrollDir);
+    PutInt(out, line.lineHeight);
+    const LaundryList& laundry = line.Laundry();
+    PutInt(out, (int)laundry.size());
+    if (!laundry.empty())
+      PutBytes(out, &laundry[0], laundry.size() * sizeof(LaundryData));
+  }
+
+  // Resident chunks field by field, the padding would defeat the delta
+  PutInt(out, gameState.firstChunk);
+  PutInt(out, gameState.numChunks);
+  for (int i = 0; i < gameState.numChunks; ++i) {
+    const LevelChunk& chunk = gameState.Chunk(i);
+    PutInt(out, chunk.index);
+    PutInt(out, chunk.numBins);
+    PutBytes(out, chunk.bins, chunk.numBins * sizeof(Rect));
+    for (int w = 0; w < WINDOWS_PER_CHUNK; ++w) PutInt(out, chunk.windowRows[w]);
+  }
+}
+
+bool StateLoad(GameStateData& gameState, const uint8_t* data, size_t size) {
+  BlobReader in = {data, size, 0, true};
+  if ((in.Int() != (int)STATE_BLOB_MAGIC) ||
+      (in.Int() != (int)sizeof(std::mt19937))) {
+    return false;
+  }
+
+  // Read into a copy so a bad blob leaves the game untouched
+  GameStateData loaded = gameState;
+
+  loaded.numCats = in.Int();
+  if (!in.ok || (loaded.numCats < 1) || (loaded.numCats > 2)) return false;
+  GetCat(in, loaded.cat);
+  GetCat(in, loaded.cat2);
+  loaded.windowsWon[0] = in.Int();
+  loaded.windowsWon[1] = in.Int();
+
+  loaded.scrollPoint.x = in.Int();
+  loaded.scrollPoint.y = in.Int();
+  in.Bytes(&loaded.level_bounds, sizeof(Rect));
+  loaded.seed = (uint32_t)in.Int();
+  loaded.movingLine = in.Int();
+  loaded.isLineMoving = in.Int() != 0;
+  loaded.lineTimer = in.Int();
+  loaded.isMeowUnlocked = in.Int() != 0;
+  loaded.activeWindow = in.Int();
+  loaded.windowOpenTick = (uint32_t)in.Int();
+  loaded.windowTimer = in.Int();
+  loaded.animCount = in.Int();
+
+  in.Bytes(&loaded.randGen, sizeof(std::mt19937));
+  TimerWheel& timers = loaded.timers;
+  timers.now = (uint32_t)in.Int();
+  in.Bytes(timers.heads, sizeof(timers.heads));
+  timers.freeHead = in.Int();
+  timers.numNodes = in.Int();
+  if (!in.ok || (timers.numNodes < 0) || (timers.numNodes > MAX_TIMERS) ||
+      (timers.freeHead >= timers.numNodes)) {
+    return false;
+  }
+  in.Bytes(timers.nodes, timers.numNodes * sizeof(TimerNode));
+
+  for (int y = 0; y < NUM_LAUNDRY_LINES; ++y) {
+    LaundryLineData& line = loaded.lines[y];
+    line.offset = in.Int();
+    line.scrollDir = in.Int();
+    line.lineHeight = in.Int();
+    int count = in.Int();
+    if (!in.ok || (count < 0) ||
+        ((size_t)count * sizeof(LaundryData) > in.size - in.pos)) {
+      return false;
+    }
+    LaundryList& laundry = line.MutableLaundry();
+    laundry.resize(count);
+    if (count > 0) in.Bytes(&laundry[0], count * sizeof(LaundryData));
+  }
+
+  loaded.firstChunk = in.Int();
+  loaded.numChunks = in.Int();
+  if (!in.ok || (loaded.firstChunk < 0) || (loaded.numChunks < 1) ||
+      (loaded.numChunks > MAX_RESIDENT_CHUNKS)) {
+    return false;
+  }
+  for (int i = 0; i < loaded.numChunks; ++i) {
+    LevelChunk& chunk = loaded.Chunk(i);
+    chunk.index = in.Int();
+    chunk.numBins = in.Int();
+    if (!in.ok || (chunk.numBins < 0) || (chunk.numBins > MAX_BINS_PER_CHUNK))
+      return false;
+    in.Bytes(chunk.bins, chunk.numBins * sizeof(Rect));
+    for (int w = 0; w < WINDOWS_PER_CHUNK; ++w)
+      chunk.windowRows[w] = (uint8_t)in.Int();
+  }
+
+  if (!in.ok) return false;
+
+  gameState = loaded;
+  return true;
+}
+
+/////// DELTA
+
+static void PutVarint(StateBlob& out, uint32_t v) {
+  while (v >= 0x80) {
+    out.push_back((uint8_t)(v | 0x80));
+    v >>= 7;
+  }
+  out.push_back((uint8_t)v);
+}
+
+static bool GetVarint(const uint8_t* in, size_t size, size_t& pos,
+                      uint32_t& v) {
+  v = 0;
+  for (int shift = 0; (pos < size) && (shift < 32); shift += 7) {
+    uint8_t b = in[pos++];
+    v |= (uint32_t)(b & 0x7F) << shift;
+    if ((b & 0x80) == 0) return true;
+  }
+  return false;
+}
+
+void DeltaEncode(const StateBlob& prev, const StateBlob& cur, StateBlob& out) {
+  out.clear();
+  PutVarint(out, (uint32_t)cur.size());
+
+  size_t n = cur.size();
+  size_t i = 0;
+  while (i < n) {
+    // Unchanged run
+    size_t zeroStart = i;
+    while ((i < n) && (i < prev.size()) && (cur[i] == prev[i])) ++i;
+    PutVarint(out, (uint32_t)(i - zeroStart));
+
+    // Changed run, short matches inside are cheaper as literals
+    size_t litStart = i;
+    while (i < n) {
+      size_t same = 0;
+      while ((i + same < n) && (i + same < prev.size()) &&
+             (cur[i + same] == prev[i + same]) && (same < 4))
+        ++same;
+      if (same >= 4) break;
+      i += same + 1;
+    }
+    if (i > n) i = n;
+    PutVarint(out, (uint32_t)(i - litStart));
+    for (size_t c = litStart; c < i; ++c)
+      out.push_back(cur[c] ^ ((c < prev.size()) ? prev[c] : 0));
+  }
+}
+
+bool DeltaDecode(const StateBlob& prev, const uint8_t* delta, size_t size,
+                 StateBlob& out) {
+  size_t pos = 0;
+  uint32_t n = 0;
+  if (!GetVarint(delta, size, pos, n)) return false;
+
+  out.resize(n);
+  size_t i = 0;
+  while (i < n) {
+    uint32_t zeros = 0, lits = 0;
+    if (!GetVarint(delta, size, pos, zeros) || (i + zeros > n) ||
+        (i + zeros > prev.size()))
+      return false;
+    if (zeros > 0) memcpy(&out[i], &prev[i], zeros);
+    i += zeros;
+
+    if (!GetVarint(delta, size, pos, lits) || (i + lits > n) ||
+        (pos + lits > size))
+      return false;
+    for (uint32_t c = 0; c < lits; ++c, ++i)
+      out[i] = delta[pos++] ^ ((i < prev.size()) ? prev[i] : 0);
+  }
+
+  return true;
+}
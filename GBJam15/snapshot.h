@@ -0,0 +1,16 @@
+#pragma once
+#include "gamestate.h"
+#include <vector>
+
+// Flat byte image of the simulated part of GameStateData (cat, laundry,
+// chunks, RNG, timers, windows, scroll). Assets and screen size are left
+// out. Fixed size fields come first so consecutive images delta well.
+typedef std::vector<uint8_t> StateBlob;
+
+void StateSave(const GameStateData& gameState, StateBlob& out);
+bool StateLoad(GameStateData& gameState, const uint8_t* data, size_t size);
+
+// XOR against prev, stored as runs of (zero count, literal count, literals)
+void DeltaEncode(const StateBlob& prev, const StateBlob& cur, StateBlob& out);
+bool DeltaDecode(const StateBlob& prev, const uint8_t* delta, size_t size,
+                 StateBlob& out);
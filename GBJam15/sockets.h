@@ -0,0 +1,76 @@
+#pragma once
+// The bits of Winsock / BSD sockets that differ, for netplay and broadcast
+#include <stdint.h>
+#include <string.h>
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET NetSocket;
+#else
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+typedef int NetSocket;
+const NetSocket INVALID_SOCKET = -1;
+#endif
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0  // Windows never raises SIGPIPE
+#endif
+
+// Pair every successful SockStartup with a SockShutdown
+inline bool SockStartup() {
+#ifdef _WIN32
+  WSADATA wsaData;
+  return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+#else
+  return true;
+#endif
+}
+
+inline void SockShutdown() {
+#ifdef _WIN32
+  WSACleanup();
+#endif
+}
+
+inline void SockClose(NetSocket sock) {
+#ifdef _WIN32
+  closesocket(sock);
+#else
+  close(sock);
+#endif
+}
+
+inline void SockSetNonBlocking(NetSocket sock) {
+#ifdef _WIN32
+  u_long nonBlocking = 1;
+  ioctlsocket(sock, FIONBIO, &nonBlocking);
+#else
+  fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+#endif
+}
+
+// After a failed send/recv, true if it only failed for not being ready
+inline bool SockWouldBlock() {
+#ifdef _WIN32
+  return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+  return (errno == EAGAIN) || (errno == EWOULDBLOCK);
+#endif
+}
+
+inline bool SockAddress(sockaddr_in& addr, const char* host, int port) {
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons((uint16_t)port);
+  if (host == nullptr) {
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    return true;
+  }
+  return inet_pton(AF_INET, host, &addr.sin_addr) == 1;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <stdint.h>
+
+// Lock-free single producer / single consumer ring of N values (N a power
+// of two). Head and tail count up forever and wrap with the mask, the
+// producer only writes head and the consumer only writes tail, so neither
+// ever waits on or allocates for the other. The buffer sits between the
+// two counters to keep them off each other's cache line.
+template <typename T, int N>
+class SpscRing {
+ public:
+  SpscRing() : m_head(0), m_tail(0) {}
+
+  // Readable values, exact for the consumer, a lower bound for the producer
+  int Size() const {
+    return (int)(m_head.load(std::memory_order_acquire) -
+                 m_tail.load(std::memory_order_acquire));
+  }
+  int Capacity() const { return N; }
+
+  // Producer, returns how many fitted
+  int Push(const T* data, int count) {
+    uint32_t head = m_head.load(std::memory_order_relaxed);
+    uint32_t tail = m_tail.load(std::memory_order_acquire);
+    int space = N - (int)(head - tail);
+    if (count > space) count = space;
+    for (int i = 0; i < count; ++i) m_buf[(head + i) & MASK] = data[i];
+    m_head.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+  // Consumer, returns how many were there
+  int Pop(T* out, int count) {
+    uint32_t tail = m_tail.load(std::memory_order_relaxed);
+    uint32_t head = m_head.load(std::memory_order_acquire);
+    int avail = (int)(head - tail);
+    if (count > avail) count = avail;
+    for (int i = 0; i < count; ++i) out[i] = m_buf[(tail + i) & MASK];
+    m_tail.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  static const uint32_t MASK = N - 1;
+
+  std::atomic<uint32_t> m_head;  // Producer only
+  T m_buf[N];
+  std::atomic<uint32_t> m_tail;  // Consumer only
+};
@@ -0,0 +1,32 @@
+#include "tiles.h"
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define TILES_SSE2 1
+#endif
+
+void TilesToLinear(const uint16_t* tiles, uint16_t* pixs, int width,
+                   int height) {
+  int tilesWide = width / TILE_SIZE;
+  for (int ty = 0; ty < height / TILE_SIZE; ++ty) {
+    const uint16_t* band = tiles + ty * tilesWide * TILE_PIXELS;
+
+    // Output in order, one tile row (8 pixels, 16 bytes) at a time
+    for (int r = 0; r < TILE_SIZE; ++r) {
+      const uint16_t* src = band + r * TILE_SIZE;
+      uint16_t* dst = pixs + (ty * TILE_SIZE + r) * width;
+      for (int tx = 0; tx < tilesWide; ++tx) {
+#ifdef TILES_SSE2
+        _mm_storeu_si128((__m128i*)dst,
+                         _mm_loadu_si128((const __m128i*)src));
+#else
+        memcpy(dst, src, TILE_SIZE * sizeof(uint16_t));
+#endif
+        src += TILE_PIXELS;
+        dst += TILE_SIZE;
+      }
+    }
+  }
+}
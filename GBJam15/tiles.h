@@ -0,0 +1,20 @@
+#pragma once
+#include <stdint.h>
+
+// Framebuffer in 8x8 tiles like the Game Boy's own: tile rows top to bottom,
+// tiles left to right, each tile's 64 pixels row by row. A tile is 128 bytes
+// so a tall narrow sprite walks down a couple of cache lines per tile instead
+// of a whole screen row per pixel row. Width and height are multiples of
+// TILE_SIZE, and only Render* knows the layout: TilesToLinear makes the
+// usual row by row picture for presenting, capture and hashing.
+const int TILE_SIZE = 8;
+const int TILE_PIXELS = TILE_SIZE * TILE_SIZE;
+
+// Of pixel (x, y) in a tiled buffer width pixels wide
+inline int TiledIndex(int x, int y, int width) {
+  return (((y >> 3) * (width >> 3) + (x >> 3)) << 6) + ((y & 7) << 3) +
+         (x & 7);
+}
+
+void TilesToLinear(const uint16_t* tiles, uint16_t* pixs, int width,
+                   int height);
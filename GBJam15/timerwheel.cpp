@@ -0,0 +1,169 @@
+#include "timerwheel.h"
+#include "SDL.h"
+#include <string.h>
+
+const int32_t LIST_FREE = -2;
+const int32_t LIST_EXPIRED = TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS;
+const uint32_t MAX_DELAY = (1u << (TIMER_WHEEL_BITS * TIMER_WHEEL_LEVELS)) - 1;
+
+static TimerHandle MakeHandle(const TimerWheel& wheel, int idx) {
+  return idx | ((wheel.nodes[idx].generation & 0x7FFF) << 16);
+}
+
+// Node index if the handle still names a pending timer, else -1
+static int HandleIndex(const TimerWheel& wheel, TimerHandle handle) {
+  if (handle < 0) return -1;
+  int idx = handle & 0xFFFF;
+  if (idx >= wheel.numNodes) return -1;
+
+  const TimerNode& node = wheel.nodes[idx];
+  if ((node.list == LIST_FREE) ||
+      ((node.generation & 0x7FFF) != (handle >> 16))) {
+    return -1;
+  }
+  return idx;
+}
+
+static void Link(TimerWheel& wheel, int idx, int list) {
+  TimerNode& node = wheel.nodes[idx];
+  node.list = list;
+  node.prev = -1;
+  node.next = wheel.heads[list];
+  if (node.next >= 0) wheel.nodes[node.next].prev = idx;
+  wheel.heads[list] = idx;
+}
+
+static void Unlink(TimerWheel& wheel, int idx) {
+  TimerNode& node = wheel.nodes[idx];
+  if (node.prev >= 0)
+    wheel.nodes[node.prev].next = node.next;
+  else
+    wheel.heads[node.list] = node.next;
+  if (node.next >= 0) wheel.nodes[node.next].prev = node.prev;
+}
+
+static void Free(TimerWheel& wheel, int idx) {
+  TimerNode& node = wheel.nodes[idx];
+  node.list = LIST_FREE;
+  ++node.generation;
+  node.next = wheel.freeHead;
+  wheel.freeHead = idx;
+}
+
+// Into the coarsest level whose slot span still holds the delay
+static void Place(TimerWheel& wheel, int idx) {
+  TimerNode& node = wheel.nodes[idx];
+  uint32_t base = wheel.now + 1;
+  uint32_t delta = node.expires - base;
+  if (delta > MAX_DELAY) {
+    delta = MAX_DELAY;
+    node.expires = base + MAX_DELAY;
+  }
+
+  int level = 0;
+  while ((level < TIMER_WHEEL_LEVELS - 1) &&
+         (delta >= (1u << (TIMER_WHEEL_BITS * (level + 1))))) {
+    ++level;
+  }
+
+  int slot =
+      (node.expires >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1);
+  Link(wheel, idx, level * TIMER_WHEEL_SLOTS + slot);
+}
+
+TimerWheel::TimerWheel(const TimerWheel& other) { *this = other; }
+
+TimerWheel& TimerWheel::operator=(const TimerWheel& other) {
+  if (this == &other) return *this;
+  now = other.now;
+  memcpy(heads, other.heads, sizeof(heads));
+  freeHead = other.freeHead;
+  numNodes = other.numNodes;
+  memcpy(nodes, other.nodes, numNodes * sizeof(TimerNode));
+  return *this;
+}
+
+void TimerInit(TimerWheel& wheel) {
+  wheel.now = 0;
+  for (int i = 0; i <= LIST_EXPIRED; ++i) wheel.heads[i] = -1;
+  wheel.freeHead = -1;
+  wheel.numNodes = 0;
+}
+
+TimerHandle TimerAdd(TimerWheel& wheel, int delay, int event, int param) {
+  // Reuse before touching a new node
+  int idx = wheel.freeHead;
+  if (idx >= 0) {
+    wheel.freeHead = wheel.nodes[idx].next;
+  } else if (wheel.numNodes < MAX_TIMERS) {
+    idx = wheel.numNodes++;
+    wheel.nodes[idx].generation = 0;
+  } else {
+    SDL_Log("TimerAdd: all %d timers pending, event %d dropped", MAX_TIMERS,
+            event);
+    SDL_assert(!"Out of timers");
+    return TIMER_NONE;
+  }
+
+  TimerNode& node = wheel.nodes[idx];
+  node.expires = wheel.now + ((delay < 1) ? 1 : delay);
+  node.event = event;
+  node.param = param;
+  Place(wheel, idx);
+
+  return MakeHandle(wheel, idx);
+}
+
+void TimerCancel(TimerWheel& wheel, TimerHandle& handle) {
+  int idx = HandleIndex(wheel, handle);
+  handle = TIMER_NONE;
+  if (idx < 0) return;
+
+  Unlink(wheel, idx);
+  Free(wheel, idx);
+}
+
+int TimerRemaining(const TimerWheel& wheel, TimerHandle handle) {
+  int idx = HandleIndex(wheel, handle);
+  if ((idx < 0) || (wheel.nodes[idx].list == LIST_EXPIRED)) return 0;
+  return (int)(wheel.nodes[idx].expires - wheel.now);
+}
+
+void TimerAdvance(TimerWheel& wheel) {
+  uint32_t tick = wheel.now + 1;
+
+  // Each level whose slot index wrapped hands its next slot down
+  for (int level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+    int lowerSlot = (tick >> (TIMER_WHEEL_BITS * (level - 1))) &
+                    (TIMER_WHEEL_SLOTS - 1);
+    if (lowerSlot != 0) break;
+
+    int list = level * TIMER_WHEEL_SLOTS +
+               ((tick >> (TIMER_WHEEL_BITS * level)) & (TIMER_WHEEL_SLOTS - 1));
+    while (wheel.heads[list] >= 0) {
+      int idx = wheel.heads[list];
+      Unlink(wheel, idx);
+      Place(wheel, idx);
+    }
+  }
+
+  int list = tick & (TIMER_WHEEL_SLOTS - 1);
+  while (wheel.heads[list] >= 0) {
+    int idx = wheel.heads[list];
+    Unlink(wheel, idx);
+    Link(wheel, idx, LIST_EXPIRED);
+  }
+
+  wheel.now = tick;
+}
+
+bool TimerPopExpired(TimerWheel& wheel, int& event, int& param) {
+  int idx = wheel.heads[LIST_EXPIRED];
+  if (idx < 0) return false;
+
+  Unlink(wheel, idx);
+  event = wheel.nodes[idx].event;
+  param = wheel.nodes[idx].param;
+  Free(wheel, idx);
+  return true;
+}
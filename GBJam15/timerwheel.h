@@ -0,0 +1,58 @@
+#pragma once
+#include <stdint.h>
+
+// Hierarchical timer wheel counted in ticks. Four levels of 64 slots cover
+// 2^24 ticks, a timer sits in the coarsest slot that holds it and drops a
+// level when that slot comes round, so insert and cancel are O(1) and a
+// tick only touches the timers that expire in it (plus the odd cascade).
+// Plain ints throughout so a game state holding one copies and serializes
+// as bytes. The pool is fixed and inline for the same reason, so it's sized
+// for what a game holds (a handful) with room to spare, running out asserts.
+// Nodes are handed out in order and only those ever used are copied or
+// saved.
+const int TIMER_WHEEL_BITS = 6;
+const int TIMER_WHEEL_SLOTS = 1 << TIMER_WHEEL_BITS;
+const int TIMER_WHEEL_LEVELS = 4;
+const int MAX_TIMERS = 128;
+
+// Index in the low 16 bits, reuse count above so stale handles are ignored
+typedef int32_t TimerHandle;
+const TimerHandle TIMER_NONE = -1;
+
+struct TimerNode {
+  uint32_t expires;
+  int32_t event;
+  int32_t param;
+  int32_t prev;
+  int32_t next;
+  int32_t list;  // Slot list it is on, FREE or EXPIRED
+  int32_t generation;
+};
+
+struct TimerWheel {
+  uint32_t now;  // Last tick advanced to
+  int32_t heads[TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOTS + 1];  // + expired
+  int32_t freeHead;
+  int32_t numNodes;  // nodes[numNodes] on have never been used
+  TimerNode nodes[MAX_TIMERS];
+
+  TimerWheel() {}
+  TimerWheel(const TimerWheel& other);
+  TimerWheel& operator=(const TimerWheel& other);
+};
+
+void TimerInit(TimerWheel& wheel);
+
+// Fires during the TimerAdvance that reaches now + delay (delay >= 1),
+// TIMER_NONE if all MAX_TIMERS are pending
+TimerHandle TimerAdd(TimerWheel& wheel, int delay, int event, int param);
+
+// Safe on TIMER_NONE, stale and already expired handles, clears it
+void TimerCancel(TimerWheel& wheel, TimerHandle& handle);
+
+// Ticks until it fires, 0 if it isn't pending
+int TimerRemaining(const TimerWheel& wheel, TimerHandle handle);
+
+// Step one tick, what expires waits in TimerPopExpired
+void TimerAdvance(TimerWheel& wheel);
+bool TimerPopExpired(TimerWheel& wheel, int& event, int& param);